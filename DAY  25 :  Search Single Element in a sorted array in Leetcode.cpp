@@ -30,3 +30,8 @@ public:
 
     }
 };
+
+// Complexity Analysis
+// Time Complexity: O(log(N))
+
+// Space Complexity: O(1)
@@ -38,3 +38,146 @@ public:
 // Time Complexity: O(N)
 
 // Space Complexity: O(1)
+
+//**Solution 3 : Optimal Approach (Independent Accumulators)
+
+#if defined(__x86_64__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define LARGEST_CLONES __attribute__((target_clones("avx2", "default")))
+#endif
+#endif
+#ifndef LARGEST_CLONES
+#define LARGEST_CLONES
+#endif
+
+class Solution
+{
+public:
+    int largest(vector<int> &arr, int n)
+    {
+        return largest(span<const int>(arr.data(), n));
+    }
+
+    // Works on any contiguous read-only range: a vector, a plain array or a
+    // memory-mapped file (Solution 4), without copying it first.
+    // On x86-64 the loop is also compiled for AVX2 and the loader picks the
+    // version once, through an ifunc, so calls carry no feature check.
+    LARGEST_CLONES
+    int largest(span<const int> arr)
+    {
+        // Four running maxima instead of one, so no iteration has to wait for
+        // the previous comparison. The compiler can keep them in SIMD lanes.
+        // arr is only read, the caller's order is left untouched.
+        int n = arr.size();
+        int m0 = arr[0], m1 = arr[0], m2 = arr[0], m3 = arr[0];
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            m0 = max(m0, arr[i]);
+            m1 = max(m1, arr[i + 1]);
+            m2 = max(m2, arr[i + 2]);
+            m3 = max(m3, arr[i + 3]);
+        }
+        for (; i < n; i++) {
+            m0 = max(m0, arr[i]);
+        }
+        return max(max(m0, m1), max(m2, m3));
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N)
+
+// Space Complexity: O(1)
+
+
+//**Solution 4 : Memory-Mapped Column Files
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Read-only view of a raw binary column file: the file is a packed array of
+// T in the machine's native (little-endian on x86/ARM) byte order, with no
+// header. Opening maps it instead of reading it, so nothing is copied and
+// pages load on first touch. The kernel is told the access is sequential,
+// so it reads ahead aggressively and drops pages behind the scan.
+template <typename T>
+class MappedColumn {
+public:
+    MappedColumn() = default;
+    MappedColumn(const MappedColumn&) = delete;
+    MappedColumn& operator=(const MappedColumn&) = delete;
+    ~MappedColumn() { close(); }
+
+    bool open(const char* path) {
+        close();
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0 || st.st_size % sizeof(T) != 0) {
+            ::close(fd);
+            return false;
+        }
+        void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) return false;
+        base = p;
+        bytes = st.st_size;
+        madvise(base, bytes, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+        madvise(base, bytes, MADV_HUGEPAGE);  // a hint; ignored where unsupported
+#endif
+        return true;
+    }
+
+    void close() {
+        if (base) munmap(base, bytes);
+        base = nullptr;
+        bytes = 0;
+    }
+
+    span<const T> data() const { return {static_cast<const T*>(base), bytes / sizeof(T)}; }
+
+    // Calls f(span) for consecutive chunks of chunkElems elements. Pages of
+    // finished chunks are released right away, so resident memory stays
+    // around one chunk even for files larger than RAM.
+    template <typename F>
+    void forEachChunk(size_t chunkElems, F f) const {
+        span<const T> all = data();
+        const size_t page = sysconf(_SC_PAGESIZE);
+        size_t released = 0;
+        for (size_t lo = 0; lo < all.size(); lo += chunkElems) {
+            f(all.subspan(lo, min(chunkElems, all.size() - lo)));
+            size_t done = (min(lo + chunkElems, all.size()) * sizeof(T)) / page * page;
+            if (done > released) {
+                madvise(static_cast<char*>(base) + released, done - released, MADV_DONTNEED);
+                released = done;
+            }
+        }
+    }
+
+private:
+    void* base = nullptr;
+    size_t bytes = 0;
+};
+
+// largest() over an int32 column file, streamed in 1M-element chunks.
+// Returns false if the file cannot be mapped or is empty.
+inline bool largestInColumnFile(const char* path, int& out) {
+    MappedColumn<int> col;
+    if (!col.open(path)) return false;
+    Solution s;
+    bool first = true;
+    col.forEachChunk(1 << 20, [&](span<const int> chunk) {
+        int m = s.largest(chunk);
+        out = first ? m : max(out, m);
+        first = false;
+    });
+    return !first;  // an empty column has no largest element
+}
+
+// Complexity Analysis
+// Time Complexity: O(N), one sequential pass over the mapped file.
+
+// Space Complexity: O(1) beyond about one chunk of resident pages.
@@ -20,3 +20,69 @@ public:
     }
 };
 
+
+//**Solution 2 : In-Place and Reusable-Buffer Modes
+
+class Solution {
+public:
+    vector<int> rearrangeArray(vector<int>& nums) {
+        vector<int> ans;
+        rearrangeInto(nums, ans);
+        return ans;
+    }
+
+    // Same stable result as Solution 1, written into a caller-owned buffer.
+    // Once out has grown to n it is reused across calls without reallocating.
+    void rearrangeInto(const vector<int>& nums, vector<int>& out) {
+        int n = nums.size();
+        out.resize(n);
+        int posIndex = 0, negIndex = 1;
+        for (int i = 0; i < n; i++) {
+            if (nums[i] < 0) {
+                out[negIndex] = nums[i];
+                negIndex += 2;
+            }
+            else {
+                out[posIndex] = nums[i];
+                posIndex += 2;
+            }
+        }
+    }
+
+    // Stable rearrangement with no second array: a stable partition puts
+    // all positives first, then an in-shuffle interleaves the halves.
+    // Both are built from std::rotate, so the only extra memory is the
+    // O(log n) recursion.
+    void rearrangeInPlace(vector<int>& nums) {
+        int n = nums.size();
+        stablePartition(nums, 0, n);
+        interleave(nums, 0, n / 2);
+    }
+
+private:
+    // Moves non-negative values before negative ones in [l, r), keeping the
+    // relative order of each group. Returns the first negative position.
+    int stablePartition(vector<int>& a, int l, int r) {
+        if (r - l <= 1) return (r > l && a[l] >= 0) ? r : l;
+        int m = l + (r - l) / 2;
+        int b1 = stablePartition(a, l, m);
+        int b2 = stablePartition(a, m, r);
+        // [l,b1) pos, [b1,m) neg, [m,b2) pos, [b2,r) neg
+        rotate(a.begin() + b1, a.begin() + m, a.begin() + b2);
+        return b1 + (b2 - m);
+    }
+
+    // Turns p1..pm n1..nm starting at l into p1 n1 p2 n2 ... pm nm.
+    void interleave(vector<int>& a, int l, int m) {
+        if (m <= 1) return;
+        int h = m / 2;
+        // p1..ph p(h+1)..pm n1..nh n(h+1)..nm  ->  p1..ph n1..nh p(h+1)..pm n(h+1)..nm
+        rotate(a.begin() + l + h, a.begin() + l + m, a.begin() + l + m + h);
+        interleave(a, l, h);
+        interleave(a, l + 2 * h, m - h);
+    }
+};
+
+// Complexity Analysis
+// rearrangeArray / rearrangeInto: O(N) time, N extra ints (reused by rearrangeInto).
+// rearrangeInPlace: O(N*log(N)) time, O(log(N)) extra space.
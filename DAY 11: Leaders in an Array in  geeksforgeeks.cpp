@@ -25,3 +25,41 @@ class Solution {
 // Time Complexity: O(N^2) { Since there are nested loops being used, at the worst case n^2 time would be consumed }.
 
 // Space Complexity: O(N) { There is no extra space being used in this approach. But, a O(N) of space for ans array will be used in the worst case }.
+
+
+//**Solution 2 : Optimal Approach (Suffix Maximum)
+
+class Solution {
+    // Function to find the leaders in the array.
+  public:
+    vector<int> leaders(int n, int arr[]) {
+        vector<int> ans(n);
+        ans.resize(leaders(n, arr, ans.data()));
+        return ans;
+    }
+
+    // Writes the leaders, in original order, into out (room for n values)
+    // and returns how many there are.
+    int leaders(int n, int arr[], int out[]) {
+        // Scan right to left keeping the maximum of everything to the right.
+        // Leaders are found last-first, so they are written from the back of
+        // out and then moved to the front in one pass.
+        int w = n;
+        int maxi = INT_MIN;
+        for (int i = n - 1; i >= 0; i--) {
+            if (arr[i] >= maxi) {
+                out[--w] = arr[i];
+                maxi = arr[i];
+            }
+        }
+        int cnt = n - w;
+        if (w > 0) copy(out + w, out + n, out);
+        return cnt;
+    }
+};
+
+
+// Complexity Analysis
+// Time Complexity: O(N) { One right-to-left pass plus one pass to move the leaders to the front }.
+
+// Space Complexity: O(1) { Apart from the output buffer }.
@@ -33,3 +33,86 @@ public:
 
 // If we consider the worst case the set operations will take O(N) in that case and the total time complexity will be approximately O(N2). 
 // And if we use the set instead of unordered_set, the time complexity for the set operations will be O(logN) and the total time complexity will be O(NlogN).
+
+
+//**Solution 2 : Range-Based Strategy (Bitset or Radix Sort)
+
+class Solution {
+public:
+    int longestConsecutive(vector<int>& nums) {
+        int n = nums.size();
+        if(n==0)  return 0;
+        auto [mn, mx] = minmax_element(nums.begin(), nums.end());
+        long long range = (long long)*mx - *mn + 1;
+
+        // A bitset over [min, max] costs range/8 bytes. That is the better
+        // choice while it stays within a few bytes per element; beyond that
+        // most of its words would be empty, so sort instead.
+        if (range <= 32LL * n) return bitsetRuns(nums, *mn, range);
+        return sortedRuns(nums);
+    }
+
+private:
+    int bitsetRuns(vector<int>& nums, int mn, long long range) {
+        vector<uint64_t> bits((range + 63) / 64);
+        for (int x : nums) {
+            long long off = (long long)x - mn;
+            bits[off >> 6] |= 1ULL << (off & 63);
+        }
+
+        // Walk each word one run at a time: ctz of the word (or of its
+        // complement) gives the length of the next run of zeros (or ones).
+        // A run of ones reaching bit 63 carries into the next word.
+        int longest = 0, run = 0;
+        for (uint64_t w : bits) {
+            int pos = 0;
+            while (pos < 64) {
+                uint64_t rest = w >> pos;
+                if (rest & 1) {
+                    int ones = rest == ~0ULL ? 64 : __builtin_ctzll(~rest);
+                    run += ones;
+                    pos += ones;
+                }
+                else {
+                    longest = max(longest, run);
+                    run = 0;
+                    if (rest == 0) break;
+                    pos += __builtin_ctzll(rest);
+                }
+            }
+        }
+        return max(longest, run);
+    }
+
+    int sortedRuns(vector<int>& nums) {
+        vector<int> a = nums;
+        radixSort(a);
+        int longest = 1, cnt = 1;
+        for (int i = 1; i < a.size(); i++) {
+            if (a[i] == a[i - 1]) continue;
+            cnt = (a[i] == a[i - 1] + 1) ? cnt + 1 : 1;
+            longest = max(longest, cnt);
+        }
+        return longest;
+    }
+
+    // LSD radix sort, 8 bits per pass. The sign bit is flipped so negative
+    // values order before positive ones.
+    void radixSort(vector<int>& a) {
+        int n = a.size();
+        vector<int> tmp(n);
+        for (int shift = 0; shift < 32; shift += 8) {
+            int cnt[257] = {0};
+            for (int x : a) cnt[((((unsigned)x) ^ 0x80000000u) >> shift & 255) + 1]++;
+            for (int i = 0; i < 256; i++) cnt[i + 1] += cnt[i];
+            for (int x : a) tmp[cnt[(((unsigned)x) ^ 0x80000000u) >> shift & 255]++] = x;
+            a.swap(tmp);
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N + range/64) with the bitset, O(4*N) with the radix sort.
+
+// Space Complexity: O(range/8) bytes with the bitset, O(N) with the radix sort.
+// Solution 1 above stays the general fallback that needs no range information.
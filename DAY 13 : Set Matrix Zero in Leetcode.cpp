@@ -40,3 +40,49 @@ public:
         }
     }
 };
+
+
+//**Solution 2 : Row and Column Masks
+
+// Solution 1 above is the O(1) extra space version (first row and column
+// used as markers). This one spends O(n + m) on masks to get two plain
+// row-major passes.
+class Solution {
+public:
+    void setZeroes(vector<vector<int>>& matrix) {
+        int n = matrix.size();
+        int m = matrix[0].size();
+        vector<char> zeroRow(n, 0);
+        vector<int> colKeep(m, -1);  // all ones, or 0 for a zeroed column
+
+        // Detection: branch-free compares, one row at a time.
+        for (int i = 0; i < n; i++) {
+            const int* row = matrix[i].data();
+            char found = 0;
+            for (int j = 0; j < m; j++) {
+                int isZero = row[j] == 0;
+                found |= isZero;
+                colKeep[j] &= isZero - 1;
+            }
+            zeroRow[i] = found;
+        }
+
+        // Clearing: whole rows are filled, the rest are ANDed with the
+        // column mask, which the compiler turns into vector instructions.
+        for (int i = 0; i < n; i++) {
+            int* row = matrix[i].data();
+            if (zeroRow[i]) {
+                fill(row, row + m, 0);
+                continue;
+            }
+            for (int j = 0; j < m; j++) {
+                row[j] &= colKeep[j];
+            }
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N*M), both passes read each row sequentially.
+
+// Space Complexity: O(N + M) for the masks.
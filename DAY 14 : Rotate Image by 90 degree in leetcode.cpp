@@ -13,3 +13,63 @@ public:
         
     }
 };
+
+
+//**Solution 2 : Blocked Transpose
+
+class Solution {
+public:
+    void rotate(vector<vector<int>>& matrix) {
+        rotateQuarterTurns(matrix, 1);
+    }
+
+    // Rotates clockwise by 90 * turns degrees. Works for any element type,
+    // e.g. vector<vector<uint8_t>> image pixels.
+    //
+    // Clockwise 90 = flip upside down, then transpose. Flipping a
+    // vector<vector<T>> swaps row headers only, so no element moves and the
+    // only real work is one blocked transpose. The same trick covers the
+    // other angles.
+    template <typename T>
+    void rotateQuarterTurns(vector<vector<T>>& matrix, int turns) {
+        switch (((turns % 4) + 4) % 4) {
+        case 1:
+            reverse(matrix.begin(), matrix.end());
+            transpose(matrix);
+            break;
+        case 2:
+            reverse(matrix.begin(), matrix.end());
+            for (auto& row : matrix) reverse(row.begin(), row.end());
+            break;
+        case 3:
+            transpose(matrix);
+            reverse(matrix.begin(), matrix.end());
+            break;
+        }
+    }
+
+private:
+    // Swaps tiles across the diagonal so both the rows and the columns
+    // touched by a tile stay in cache; the naive loop walks a full column
+    // per row once n gets large.
+    template <typename T>
+    void transpose(vector<vector<T>>& matrix) {
+        const int B = 32;
+        int n = matrix.size();
+        for (int ii = 0; ii < n; ii += B) {
+            for (int jj = ii; jj < n; jj += B) {
+                int iEnd = min(ii + B, n), jEnd = min(jj + B, n);
+                for (int i = ii; i < iEnd; i++) {
+                    for (int j = max(jj, i + 1); j < jEnd; j++) {
+                        swap(matrix[i][j], matrix[j][i]);
+                    }
+                }
+            }
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N^2), one tiled pass over the upper triangle.
+
+// Space Complexity: O(1)
@@ -16,3 +16,399 @@ public:
     return cnt;
     }
 };
+
+
+//**Solution 2 : Flat Hash Map
+
+// Open addressing hash map from int to int with linear probing.
+// All slots live in one array, so a lookup touches one or two cache lines
+// instead of walking the nodes of a balanced tree. reserve() sizes the
+// table to a power of two at least twice the element count, so it never
+// has to grow while the solution runs.
+struct FlatIntMap {
+    struct Slot {
+        int key;
+        int val;
+        bool used;
+    };
+    vector<Slot> slots;
+    unsigned mask = 0;
+    int shift = 31;
+
+    void reserve(int n) {
+        unsigned cap = 2;
+        int bits = 1;
+        while (cap < 2u * n) {
+            cap <<= 1;
+            bits++;
+        }
+        slots.assign(cap, Slot{0, 0, false});
+        mask = cap - 1;
+        shift = 32 - bits;
+    }
+
+    // Fibonacci hashing: the top bits of key * 2^32/phi pick the slot.
+    unsigned home(int key) const { return ((unsigned)key * 2654435769u) >> shift; }
+
+    // Count stored for key, 0 if it is missing. Never inserts.
+    int get(int key) const {
+        for (unsigned h = home(key); slots[h].used; h = (h + 1) & mask) {
+            if (slots[h].key == key) return slots[h].val;
+        }
+        return 0;
+    }
+
+    // Returns the value stored for key, inserting 0 if it is missing.
+    int& operator[](int key) {
+        unsigned h = home(key);
+        while (slots[h].used && slots[h].key != key) h = (h + 1) & mask;
+        if (!slots[h].used) slots[h] = Slot{key, 0, true};
+        return slots[h].val;
+    }
+};
+
+class Solution {
+public:
+    int subarraySum(vector<int>& nums, int k) {
+        int n = nums.size();
+        FlatIntMap mpp;
+        mpp.reserve(n + 1);  // at most n + 1 distinct prefix sums
+        int preSum = 0, cnt = 0;
+
+        mpp[0] = 1;
+        for (int i = 0; i < n; i++) {
+            preSum += nums[i];
+            // get() does not insert, unlike mpp[remove] on std::map
+            cnt += mpp.get(preSum - k);
+            mpp[preSum] += 1;
+        }
+        return cnt;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), the std::map version is O(N*log(N))
+
+// Space Complexity: O(N)
+
+
+//**Solution 3 : 64-bit Prefix Sums, Parallel Scan and Partitioned Counting
+
+// Same table with 64-bit keys, for prefix sums that do not fit in int.
+struct FlatLongMap {
+    struct Slot {
+        long long key;
+        int val;
+        bool used;
+    };
+    vector<Slot> slots;
+    unsigned long long mask = 0;
+    int shift = 63;
+
+    void reserve(size_t n) {
+        unsigned long long cap = 2;
+        int bits = 1;
+        while (cap < 2 * n) {
+            cap <<= 1;
+            bits++;
+        }
+        slots.assign(cap, Slot{0, 0, false});
+        mask = cap - 1;
+        shift = 64 - bits;
+    }
+
+    // Fibonacci hashing with the 64-bit constant 2^64/phi.
+    unsigned long long home(long long key) const {
+        return ((unsigned long long)key * 11400714819323198485ull) >> shift;
+    }
+
+    int get(long long key) const {
+        for (unsigned long long h = home(key); slots[h].used; h = (h + 1) & mask) {
+            if (slots[h].key == key) return slots[h].val;
+        }
+        return 0;
+    }
+
+    int& operator[](long long key) {
+        unsigned long long h = home(key);
+        while (slots[h].used && slots[h].key != key) h = (h + 1) & mask;
+        if (!slots[h].used) slots[h] = Slot{key, 0, true};
+        return slots[h].val;
+    }
+};
+
+// One step of the prefix-sum scan, routed to the thread owning value.
+struct PrefixEvent {
+    long long value;
+    bool insert;  // insert value, or look it up
+};
+
+class Solution {
+public:
+    // Below this many elements per thread, threads cost more than they save.
+    static const int kMinPerThread = 1 << 16;
+
+    int subarraySum(vector<int>& nums, int k) {
+        return subarraySumWide(nums, k, thread::hardware_concurrency());
+    }
+
+    // Counts pairs i < j of prefix sums with P[j] - P[i] = k, P[0] = 0,
+    // summing in 64 bits so long series cannot overflow.
+    //
+    // 1. Each thread sums its chunk, and the chunk totals are scanned
+    //    serially (one per thread) into starting offsets.
+    // 2. Prefix values are split between threads by hash: thread t owns the
+    //    values whose hash lands in partition t. Each thread walks only its
+    //    own chunk, rebuilding P from its offset, and drops the events
+    //    "look up P[j] - k" and "insert P[j]" into one bucket per owner.
+    // 3. Each owner replays its buckets chunk by chunk. Chunks are in index
+    //    order and each bucket is in index order, so every lookup sees
+    //    exactly the inserts before it, and no tables need merging.
+    // Every element is read by one thread in each phase, so the work per
+    // thread is O(N/T).
+    long long subarraySumWide(const vector<int>& nums, long long k, unsigned threads) {
+        int n = nums.size();
+        int t = max(1, min<int>(threads, n / kMinPerThread));
+        auto chunkBegin = [&](int c) { return (long long)n * c / t; };
+
+        vector<long long> offset(t + 1, 0);
+        runThreads(t, [&](int c) {
+            long long s = 0;
+            for (long long i = chunkBegin(c); i < chunkBegin(c + 1); i++) s += nums[i];
+            offset[c + 1] = s;
+        });
+        for (int c = 0; c < t; c++) offset[c + 1] += offset[c];
+
+        // The top 32 bits of the hash, scaled to [0, t) with a multiply.
+        auto owner = [t](long long v) {
+            return (int)(((((unsigned long long)v * 11400714819323198485ull) >> 32) * t) >> 32);
+        };
+
+        // buckets[c * t + o] holds chunk c's events for owner o.
+        vector<vector<PrefixEvent>> buckets(t * t);
+        vector<size_t> inserts(t * t, 0);
+        runThreads(t, [&](int c) {
+            vector<PrefixEvent>* mine = &buckets[c * t];
+            size_t* added = &inserts[c * t];
+            long long len = chunkBegin(c + 1) - chunkBegin(c);
+            for (int o = 0; o < t; o++) mine[o].reserve(2 * len / t + 16);
+            long long s = offset[c];
+            if (c == 0) {
+                mine[owner(0)].push_back({0, true});
+                added[owner(0)]++;
+            }
+            for (long long i = chunkBegin(c); i < chunkBegin(c + 1); i++) {
+                s += nums[i];
+                mine[owner(s - k)].push_back({s - k, false});
+                int o = owner(s);
+                mine[o].push_back({s, true});
+                added[o]++;
+            }
+        });
+
+        vector<long long> partial(t, 0);
+        runThreads(t, [&](int o) {
+            // Sized from an exact count of owned inserts, so the table never
+            // fills up even if the hash split is uneven.
+            size_t owned = 0;
+            for (int c = 0; c < t; c++) owned += inserts[c * t + o];
+            FlatLongMap seen;
+            seen.reserve(owned + 1);
+            long long cnt = 0;
+            for (int c = 0; c < t; c++) {
+                for (const PrefixEvent& e : buckets[c * t + o]) {
+                    if (e.insert) seen[e.value] += 1;
+                    else cnt += seen.get(e.value);
+                }
+                vector<PrefixEvent>().swap(buckets[c * t + o]);
+            }
+            partial[o] = cnt;
+        });
+        return accumulate(partial.begin(), partial.end(), 0LL);
+    }
+
+private:
+    // Runs body(0) .. body(t - 1), on the calling thread when t == 1.
+    template <typename Body>
+    static void runThreads(int t, Body body) {
+        if (t == 1) {
+            body(0);
+            return;
+        }
+        vector<thread> pool;
+        for (int c = 1; c < t; c++) pool.emplace_back(body, c);
+        body(0);
+        for (auto& th : pool) th.join();
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) work in total, about O(N/T) wall time on T threads.
+
+// Space Complexity: O(N) for the event buckets and the tables.
+
+
+//**Solution 4 : Dynamic Array with Fenwick and Segment Trees
+
+// Prefix sums under point updates. Node i (1-based) holds the sum of the
+// lowbit(i) elements ending at i, all in one contiguous array.
+class FenwickTree {
+public:
+    explicit FenwickTree(int n = 0) : tree(n + 1, 0) {}
+
+    // O(n) build: each node pushes its total up to its parent once.
+    explicit FenwickTree(const vector<long long>& a) : tree(a.size() + 1, 0) {
+        int n = a.size();
+        for (int i = 1; i <= n; i++) {
+            tree[i] += a[i - 1];
+            int parent = i + (i & -i);
+            if (parent <= n) tree[parent] += tree[i];
+        }
+    }
+
+    int size() const { return tree.size() - 1; }
+
+    void add(int i, long long delta) {
+        for (i++; i < (int)tree.size(); i += i & -i) tree[i] += delta;
+    }
+
+    // Sum of a[0 .. i).
+    long long prefix(int i) const {
+        long long s = 0;
+        for (; i > 0; i -= i & -i) s += tree[i];
+        return s;
+    }
+
+    // Sum of a[l .. r).
+    long long rangeSum(int l, int r) const { return prefix(r) - prefix(l); }
+
+    // Applies updates[0..n) in order.
+    void addBatch(const pair<int, long long>* updates, int n) {
+        for (int u = 0; u < n; u++) add(updates[u].first, updates[u].second);
+    }
+
+    // out[q] = prefix(idx[q]). Queries are independent, so the loop has no
+    // carried dependency and the memory loads of different queries overlap.
+    void prefixBatch(const int* idx, int n, long long* out) const {
+        for (int q = 0; q < n; q++) out[q] = prefix(idx[q]);
+    }
+
+private:
+    vector<long long> tree;
+};
+
+// Range add and range sum, both O(log n), with lazy propagation: a pending
+// add for a whole node is kept in lazy[] and pushed to the children only
+// when a later operation needs to look inside it.
+class RangeAddTree {
+public:
+    explicit RangeAddTree(const vector<long long>& a) : n(a.size()), sum(4 * max(n, 1)), lazy(4 * max(n, 1)) {
+        if (n) build(1, 0, n, a);
+    }
+
+    // Adds delta to every a[i], l <= i < r.
+    void rangeAdd(int l, int r, long long delta) {
+        if (l < r) update(1, 0, n, l, r, delta);
+    }
+
+    // Sum of a[l .. r).
+    long long rangeSum(int l, int r) {
+        return l < r ? query(1, 0, n, l, r) : 0;
+    }
+
+private:
+    int n;
+    vector<long long> sum, lazy;
+
+    void build(int node, int lo, int hi, const vector<long long>& a) {
+        if (hi - lo == 1) {
+            sum[node] = a[lo];
+            return;
+        }
+        int mid = (lo + hi) / 2;
+        build(2 * node, lo, mid, a);
+        build(2 * node + 1, mid, hi, a);
+        sum[node] = sum[2 * node] + sum[2 * node + 1];
+    }
+
+    void apply(int node, int lo, int hi, long long delta) {
+        sum[node] += delta * (hi - lo);
+        lazy[node] += delta;
+    }
+
+    void push(int node, int lo, int hi) {
+        if (lazy[node] == 0) return;
+        int mid = (lo + hi) / 2;
+        apply(2 * node, lo, mid, lazy[node]);
+        apply(2 * node + 1, mid, hi, lazy[node]);
+        lazy[node] = 0;
+    }
+
+    void update(int node, int lo, int hi, int l, int r, long long delta) {
+        if (r <= lo || hi <= l) return;
+        if (l <= lo && hi <= r) {
+            apply(node, lo, hi, delta);
+            return;
+        }
+        push(node, lo, hi);
+        int mid = (lo + hi) / 2;
+        update(2 * node, lo, mid, l, r, delta);
+        update(2 * node + 1, mid, hi, l, r, delta);
+        sum[node] = sum[2 * node] + sum[2 * node + 1];
+    }
+
+    long long query(int node, int lo, int hi, int l, int r) {
+        if (r <= lo || hi <= l) return 0;
+        if (l <= lo && hi <= r) return sum[node];
+        push(node, lo, hi);
+        int mid = (lo + hi) / 2;
+        return query(2 * node, lo, mid, l, r) + query(2 * node + 1, mid, hi, l, r);
+    }
+};
+
+// An array that takes point updates and answers range sums in O(log n)
+// through a Fenwick tree, and counts subarrays equal to k inside any
+// window without rebuilding anything for the rest of the array.
+class DynamicSubarraySums {
+public:
+    explicit DynamicSubarraySums(const vector<int>& nums)
+        : value(nums.begin(), nums.end()), fenwick(value) {}
+
+    void set(int i, long long v) {
+        fenwick.add(i, v - value[i]);
+        value[i] = v;
+    }
+
+    void add(int i, long long delta) {
+        fenwick.add(i, delta);
+        value[i] += delta;
+    }
+
+    long long rangeSum(int l, int r) const { return fenwick.rangeSum(l, r); }
+
+    // Subarrays of a[l .. r) summing to k: the DAY 15 prefix-count scan
+    // restricted to the window. Only the window is read, so the cost is
+    // O(r - l) however large the array.
+    long long countSubarrays(int l, int r, long long k) const {
+        FlatLongMap seen;
+        seen.reserve(r - l + 1);
+        long long preSum = 0, cnt = 0;
+        seen[0] = 1;
+        for (int i = l; i < r; i++) {
+            preSum += value[i];
+            cnt += seen.get(preSum - k);
+            seen[preSum] += 1;
+        }
+        return cnt;
+    }
+
+private:
+    vector<long long> value;
+    FenwickTree fenwick;
+};
+
+// Complexity Analysis
+// Time Complexity: O(log(N)) per Fenwick update/query and per segment tree range add/sum;
+// O(N) to build either; O(r - l) for countSubarrays.
+
+// Space Complexity: O(N) for the Fenwick tree, O(4N) for the segment tree.
@@ -14,3 +14,55 @@ public:
     return ans;
     }
 };
+
+
+//**Solution 2 : Saturating 64-bit Products
+
+class Solution {
+public:
+    int maxProduct(vector<int>& nums) {
+        long long ans = maxProductWide(nums);
+        return (int)max<long long>(INT_MIN, min<long long>(INT_MAX, ans));
+    }
+
+    // Same prefix/suffix scan with 64-bit products. A product that no longer
+    // fits is pinned to LLONG_MAX or LLONG_MIN, keeping its sign, so later
+    // sign flips and zero resets still behave correctly. Any answer that
+    // fits in 64 bits is exact, and plain int pre/suff can no longer wrap.
+    long long maxProductWide(const vector<int>& nums) {
+        int n = nums.size();
+        long long pre = 1, suff = 1;
+        long long ans = LLONG_MIN;
+        for (int i = 0; i < n; i++) {
+            if (pre == 0) pre = 1;
+            if (suff == 0) suff = 1;
+            pre = satMul(pre, nums[i]);
+            suff = satMul(suff, nums[n - i - 1]);
+            ans = max(ans, max(pre, suff));
+        }
+        return ans;
+    }
+
+    // Evaluates many short arrays in one call.
+    vector<long long> maxProductBatch(const vector<vector<int>>& batch) {
+        vector<long long> out(batch.size());
+        for (int i = 0; i < batch.size(); i++) {
+            out[i] = maxProductWide(batch[i]);
+        }
+        return out;
+    }
+
+private:
+    static long long satMul(long long a, int b) {
+        long long r;
+        if (__builtin_mul_overflow(a, (long long)b, &r)) {
+            return ((a < 0) != (b < 0)) ? LLONG_MIN : LLONG_MAX;
+        }
+        return r;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N)
+
+// Space Complexity: O(1)
@@ -16,3 +16,45 @@ public:
     
     }
 };
+
+
+//**Solution 2 : Branchless Binary Search
+
+class Solution {
+public:
+    int search(vector<int>& nums, int target) {
+        int i = lowerBound(nums, target);
+        return (i < nums.size() && nums[i] == target) ? i : -1;
+    }
+
+    // The sorted-index primitive shared by DAY 17, 18 and 22: the first
+    // index of a[0..n) for which goRight(a[i]) is false, where goRight holds
+    // on a prefix of the array. The loop always runs log2(n) times and the
+    // only decision is which half base moves to, which compiles to a
+    // conditional move instead of a branch. Both candidates for the next
+    // probe are prefetched, so the cache miss for the next step overlaps
+    // with this one.
+    template <typename GoRight>
+    static int branchlessBound(const int* a, int n, GoRight goRight) {
+        if (n == 0) return 0;
+        const int* base = a;
+        while (n > 1) {
+            int half = n / 2;
+            __builtin_prefetch(base + half / 2);
+            __builtin_prefetch(base + half + half / 2);
+            base = goRight(base[half]) ? base + half : base;
+            n -= half;
+        }
+        return (base - a) + goRight(*base);
+    }
+
+    // First index with nums[i] >= target, nums.size() if none.
+    static int lowerBound(const vector<int>& nums, int target) {
+        return branchlessBound(nums.data(), nums.size(), [target](int x) { return x < target; });
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(log(N)), one conditional move per halving
+
+// Space Complexity: O(1)
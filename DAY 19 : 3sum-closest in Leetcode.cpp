@@ -19,3 +19,66 @@ public:
         return ans;
     }
 };
+
+
+//**Solution 2 : Pruned Two-Pointer Scan
+
+class Solution {
+public:
+    int threeSumClosest(vector<int>& nums, int target) {
+        sort(nums.begin(), nums.end());
+        return closestSorted(nums, target);
+    }
+
+    // Leaves nums untouched: sorts a copy into scratch instead. Reusing the
+    // same scratch across calls avoids a fresh allocation each time.
+    int threeSumClosest(const vector<int>& nums, int target, vector<int>& scratch) {
+        scratch.assign(nums.begin(), nums.end());
+        sort(scratch.begin(), scratch.end());
+        return closestSorted(scratch, target);
+    }
+
+private:
+    int closestSorted(const vector<int>& nums, int target) {
+        int n = nums.size();
+        int ans = nums[0] + nums[1] + nums[2];
+        auto better = [&](int sum) {
+            if (abs(sum - target) < abs(ans - target)) ans = sum;
+        };
+
+        for (int i = 0; i < n - 2; i++) {
+            // The same pivot value would repeat the same scan.
+            if (i > 0 && nums[i] == nums[i - 1]) continue;
+
+            // Smallest sum with this pivot. If even that overshoots, every
+            // later pivot overshoots by more, so nothing can beat it.
+            int lo = nums[i] + nums[i + 1] + nums[i + 2];
+            if (lo > target) {
+                better(lo);
+                break;
+            }
+            // Largest sum with this pivot. If it is still short, the scan
+            // below cannot get any closer.
+            int hi = nums[i] + nums[n - 2] + nums[n - 1];
+            if (hi < target) {
+                better(hi);
+                continue;
+            }
+
+            int j = i + 1, k = n - 1;
+            while (j < k) {
+                int sum = nums[i] + nums[j] + nums[k];
+                if (sum == target) return target;
+                better(sum);
+                if (sum > target) k--;
+                else j++;
+            }
+        }
+        return ans;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N^2) in the worst case, pruned pivots cost O(1).
+
+// Space Complexity: O(1) in place, O(N) scratch for the non-mutating overload.
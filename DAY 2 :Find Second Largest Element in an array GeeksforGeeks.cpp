@@ -18,3 +18,70 @@ public:
         return second_largest == INT_MIN ? -1 : second_largest;
     }
 };
+
+
+//**Solution 2 : K largest distinct elements over a stream of chunks
+
+// Keeps the k largest distinct values seen so far in a buffer sorted in
+// ascending order, so vals[0] is the smallest value still being kept.
+// The buffer is reserved once in the constructor and never grows past k,
+// so feeding elements never allocates. k <= 0 keeps nothing.
+class KLargestDistinct {
+    vector<int> vals;
+    int k;
+
+public:
+    KLargestDistinct(int k) : k(max(k, 0)) { vals.reserve(this->k); }
+
+    void push(int x) {
+        if (k == 0) return;
+        // Once the buffer is full most elements are rejected right here.
+        if ((int)vals.size() == k && x <= vals[0]) return;
+
+        auto it = lower_bound(vals.begin(), vals.end(), x);
+        if (it != vals.end() && *it == x) return;  // already kept
+
+        if ((int)vals.size() < k) {
+            vals.insert(it, x);
+            return;
+        }
+        // Full: drop vals[0] and shift the smaller values down by one.
+        int pos = it - vals.begin();
+        copy(vals.begin() + 1, vals.begin() + pos, vals.begin());
+        vals[pos - 1] = x;
+    }
+
+    // Feed one chunk of the stream.
+    void add(int arr[], int n) {
+        for (int i = 0; i < n; i++) push(arr[i]);
+    }
+
+    void add(span<const int> chunk) {
+        for (int x : chunk) push(x);
+    }
+
+    // k-th largest distinct value, or -1 if fewer than k were seen.
+    int kth() const { return k > 0 && (int)vals.size() == k ? vals[0] : -1; }
+
+    // The kept values, largest first.
+    vector<int> values() const { return vector<int>(vals.rbegin(), vals.rend()); }
+};
+
+class Solution {
+public:
+    int print2largest(int arr[], int n) {
+        return print2largest(span<const int>(arr, n));
+    }
+
+    int print2largest(span<const int> arr) {
+        KLargestDistinct top(2);
+        top.add(arr);
+        return top.kth();
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N*K) in the worst case, O(N) once the buffer is full
+// and most elements are smaller than the k-th largest.
+
+// Space Complexity: O(K)
@@ -14,3 +14,133 @@ public:
         return nums;
     }
 };
+
+
+//**Solution 2 : Hybrid Sort Engine
+
+class Solution {
+public:
+    // Size thresholds for picking an algorithm.
+    static const int kInsertionMax = 32;
+    static const int kRadixMin = 1 << 12;
+    // Counting sort is used when the value range is at most this many
+    // times the input size, so the count array stays about as big as nums.
+    static const int kCountingRangeFactor = 2;
+
+    enum class Algo { Auto, Selection, Insertion, Intro, Radix, Counting };
+
+    // What one linear pass over the input tells us about it.
+    struct Shape {
+        int n = 0;
+        int minValue = 0;
+        int maxValue = 0;
+        int descents = 0;  // positions where nums[i] > nums[i + 1]
+        int ascents = 0;   // positions where nums[i] < nums[i + 1]
+    };
+
+    vector<int> sortArray(vector<int>& nums) {
+        return sortArray(nums, Algo::Auto);
+    }
+
+    vector<int> sortArray(vector<int>& nums, Algo algo) {
+        if (algo == Algo::Auto) {
+            Shape s = sample(nums);
+            if (s.descents == 0) return nums;  // already sorted
+            if (s.ascents == 0) {              // non-increasing
+                reverse(nums.begin(), nums.end());
+                return nums;
+            }
+            algo = choose(s);
+        }
+        switch (algo) {
+        case Algo::Selection: selectionSort(nums); break;
+        case Algo::Insertion: insertionSort(nums); break;
+        case Algo::Radix:     radixSort(nums); break;
+        case Algo::Counting:  countingSort(nums); break;
+        default:              sort(nums.begin(), nums.end()); break;  // introsort
+        }
+        return nums;
+    }
+
+    // One read per element, which is small next to any of the sorts it picks from.
+    static Shape sample(const vector<int>& nums) {
+        Shape s;
+        s.n = nums.size();
+        if (s.n == 0) return s;
+        s.minValue = s.maxValue = nums[0];
+        for (int i = 1; i < s.n; i++) {
+            s.minValue = min(s.minValue, nums[i]);
+            s.maxValue = max(s.maxValue, nums[i]);
+            s.descents += nums[i - 1] > nums[i];
+            s.ascents += nums[i - 1] < nums[i];
+        }
+        return s;
+    }
+
+    static Algo choose(const Shape& s) {
+        if (s.n <= kInsertionMax) return Algo::Insertion;
+        long long range = (long long)s.maxValue - s.minValue + 1;
+        if (range <= (long long)kCountingRangeFactor * s.n) return Algo::Counting;
+        return s.n >= kRadixMin ? Algo::Radix : Algo::Intro;
+    }
+
+private:
+    // Solution 1, kept for tests and as a reference.
+    void selectionSort(vector<int>& nums) {
+        int n = nums.size();
+        for (int i = 0; i < n - 1; ++i) {
+            int min_idx = i;
+            for (int j = i + 1; j < n; ++j) {
+                if (nums[j] < nums[min_idx]) {
+                    min_idx = j;
+                }
+            }
+            swap(nums[i], nums[min_idx]);
+        }
+    }
+
+    void insertionSort(vector<int>& nums) {
+        for (int i = 1; i < nums.size(); i++) {
+            int x = nums[i];
+            int j = i - 1;
+            while (j >= 0 && nums[j] > x) {
+                nums[j + 1] = nums[j];
+                j--;
+            }
+            nums[j + 1] = x;
+        }
+    }
+
+    // LSD radix sort over 32-bit ints, 8 bits per pass. The sign bit is
+    // flipped so negative values order before positive ones. A pass whose
+    // byte is the same for every element is skipped.
+    void radixSort(vector<int>& nums) {
+        int n = nums.size();
+        vector<int> tmp(n);
+        for (int shift = 0; shift < 32; shift += 8) {
+            int cnt[257] = {0};
+            for (int x : nums) cnt[((((unsigned)x) ^ 0x80000000u) >> shift & 255) + 1]++;
+            if (*max_element(cnt + 1, cnt + 257) == n) continue;
+            for (int i = 0; i < 256; i++) cnt[i + 1] += cnt[i];
+            for (int x : nums) tmp[cnt[(((unsigned)x) ^ 0x80000000u) >> shift & 255]++] = x;
+            nums.swap(tmp);
+        }
+    }
+
+    // One count per value in [min, max], then a fill pass.
+    void countingSort(vector<int>& nums) {
+        if (nums.empty()) return;
+        auto [lo, hi] = minmax_element(nums.begin(), nums.end());
+        int base = *lo;
+        vector<int> cnt((long long)*hi - base + 1);
+        for (int x : nums) cnt[(long long)x - base]++;
+        auto it = nums.begin();
+        for (size_t v = 0; v < cnt.size(); v++) it = fill_n(it, cnt[v], (int)(base + (long long)v));
+    }
+};
+
+// Complexity Analysis
+// Selection / insertion sort: O(N^2), used only for tiny inputs or tests.
+// Introsort: O(N*log(N)). Radix sort: O(4*N) time, O(N) extra space.
+// Counting sort: O(N + range) time and space, picked only when range <= 2*N.
+// Sorted or non-increasing input is detected by the shape scan and costs O(N).
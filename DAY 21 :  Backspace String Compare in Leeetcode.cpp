@@ -26,3 +26,39 @@ public:
         return false;
     }
 };
+
+
+//**Solution 2 : Reverse Two Pointers, O(1) Extra Space
+
+class Solution {
+public:
+    bool backspaceCompare(string_view s, string_view t) {
+        int i = s.size() - 1, j = t.size() - 1;
+        while (true) {
+            i = nextKept(s, i);
+            j = nextKept(t, j);
+            if (i < 0 || j < 0) return i < 0 && j < 0;
+            if (s[i] != t[j]) return false;  // first mismatch ends it
+            i--;
+            j--;
+        }
+    }
+
+private:
+    // Index of the last character at or before i that no '#' erases, -1 if
+    // there is none. Walking from the end, each '#' skips one character.
+    int nextKept(string_view s, int i) {
+        int skip = 0;
+        for (; i >= 0; i--) {
+            if (s[i] == '#') skip++;
+            else if (skip > 0) skip--;
+            else break;
+        }
+        return i;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N + M)
+
+// Space Complexity: O(1), nothing is copied and nothing is printed.
@@ -34,3 +34,57 @@ public:
         return idx;
     }    
 };
+
+// Complexity Analysis
+// Time Complexity: O(log(N)), two binary searches
+
+// Space Complexity: O(1)
+
+
+//**Solution 2 : Branchless Lower and Upper Bound
+
+class Solution {
+public:
+    vector<int> searchRange(vector<int>& nums, int target) {
+        int lo = lowerBound(nums, target);
+        if (lo == nums.size() || nums[lo] != target) return {-1, -1};
+        int hi = upperBound(nums, target);
+        return {lo, hi - 1};
+    }
+
+    // The sorted-index primitive shared by DAY 17, 18 and 22: the first
+    // index of a[0..n) for which goRight(a[i]) is false, where goRight holds
+    // on a prefix of the array. The loop always runs log2(n) times and the
+    // only decision is which half base moves to, which compiles to a
+    // conditional move instead of a branch. Both candidates for the next
+    // probe are prefetched, so the cache miss for the next step overlaps
+    // with this one.
+    template <typename GoRight>
+    static int branchlessBound(const int* a, int n, GoRight goRight) {
+        if (n == 0) return 0;
+        const int* base = a;
+        while (n > 1) {
+            int half = n / 2;
+            __builtin_prefetch(base + half / 2);
+            __builtin_prefetch(base + half + half / 2);
+            base = goRight(base[half]) ? base + half : base;
+            n -= half;
+        }
+        return (base - a) + goRight(*base);
+    }
+
+    // First index with nums[i] >= target, nums.size() if none.
+    static int lowerBound(const vector<int>& nums, int target) {
+        return branchlessBound(nums.data(), nums.size(), [target](int x) { return x < target; });
+    }
+
+    // First index with nums[i] > target, nums.size() if none.
+    static int upperBound(const vector<int>& nums, int target) {
+        return branchlessBound(nums.data(), nums.size(), [target](int x) { return x <= target; });
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(log(N)), two branchless bounds
+
+// Space Complexity: O(1)
@@ -15,3 +15,166 @@ pair<int, int> getFloorAndCeil(int arr[], int n, int x) {
     if(maxi==INT_MAX) maxi=-1;
     return {mini,maxi};
 }
+
+
+//**Solution 2 : Batched Lookups with Group Prefetching
+
+// For every query keys[t], writes the index of the first element >= keys[t]
+// (searchInsert's answer) to idx[t].
+// Every search over the same array takes the same number of halving steps,
+// so G queries advance in lockstep: each round moves all G one step and
+// prefetches their next probes. G cache misses are then in flight at once
+// instead of being paid one after another.
+void lowerBoundBatch(int arr[], int n, const int keys[], int q, int idx[]) {
+    const int G = 16;
+    for (int q0 = 0; q0 < q; q0 += G) {
+        int g = min(G, q - q0);
+        if (n == 0) {
+            fill(idx + q0, idx + q0 + g, 0);
+            continue;
+        }
+        int base[G] = {0};
+        int len = n;
+        while (len > 1) {
+            int half = len / 2;
+            int next = (len - half) / 2;
+            for (int t = 0; t < g; t++) {
+                base[t] += (arr[base[t] + half] < keys[q0 + t]) ? half : 0;
+                __builtin_prefetch(arr + base[t] + next);
+            }
+            len -= half;
+        }
+        for (int t = 0; t < g; t++) {
+            idx[q0 + t] = base[t] + (arr[base[t]] < keys[q0 + t]);
+        }
+    }
+}
+
+// Batched getFloorAndCeil: out[t] is what getFloorAndCeil(arr, n, keys[t])
+// returns, idx[t] the insert position of keys[t]. arr must be sorted.
+void getFloorAndCeilBatch(int arr[], int n, const int keys[], int q, int idx[], pair<int, int> out[]) {
+    lowerBoundBatch(arr, n, keys, q, idx);
+    for (int t = 0; t < q; t++) {
+        int i = idx[t];
+        int ceil = i < n ? arr[i] : -1;
+        int floor = (i < n && arr[i] == keys[t]) ? keys[t] : (i > 0 ? arr[i - 1] : -1);
+        out[t] = {floor, ceil};
+    }
+}
+
+// Complexity Analysis
+// Time Complexity: O(Q*log(N)) for Q queries, with up to 16 probes in flight.
+
+// Space Complexity: O(1) apart from the outputs.
+
+
+//**Solution 3 : Build-Once Floor/Ceil Index
+
+// Sorted keys stored in Eytzinger (BFS) order; the children of slot k are
+// 2k and 2k+1. Each slot also carries the key just before it in sorted
+// order, so the slot found by the search already holds both the ceil and
+// the floor and no second lookup into a sorted array is needed.
+class FloorCeilIndex {
+    struct Slot {
+        int key;
+        int prev;  // previous key in sorted order, -1 for the smallest
+    };
+    vector<Slot> slots;  // slot 0 unused
+    int n;
+    int last;  // largest key, the floor of anything above it
+
+    int fill(const vector<int>& sorted, int i, int k) {
+        if (k <= n) {
+            i = fill(sorted, i, 2 * k);
+            slots[k] = {sorted[i], i > 0 ? sorted[i - 1] : -1};
+            i = fill(sorted, i + 1, 2 * k + 1);
+        }
+        return i;
+    }
+
+public:
+    // sorted must be in ascending order.
+    FloorCeilIndex(const vector<int>& sorted)
+        : slots(sorted.size() + 1), n(sorted.size()), last(sorted.empty() ? -1 : sorted.back()) {
+        fill(sorted, 0, 1);
+    }
+
+    // Same answer as getFloorAndCeil over the sorted keys.
+    pair<int, int> query(int x) const {
+        int k = 1;
+        while (k <= n) {
+            __builtin_prefetch(slots.data() + k * 8);  // 8 slots per cache line
+            k = 2 * k + (slots[k].key < x);
+        }
+        k >>= __builtin_ffs(~k);
+        if (k == 0) return {last, -1};  // every key is below x
+        const Slot& s = slots[k];
+        return {s.key == x ? x : s.prev, s.key};
+    }
+};
+
+// A floor/ceil table that can be rebuilt while queries keep running.
+// Queries are lock-free: a reader registers under the current epoch with
+// one counter increment, loads the index pointer and unregisters when done.
+// rebuild() swaps the pointer, advances the epoch and then waits until no
+// reader of the previous epoch is left before freeing the old index, so a
+// query in flight never sees it disappear. Rebuilds are serialized by a
+// mutex and are the only side that ever waits.
+class FloorCeilTable {
+    atomic<const FloorCeilIndex*> current;
+    atomic<unsigned long long> epoch{0};
+    alignas(64) mutable atomic<long> readers[2] = {};  // active readers by epoch parity
+    mutex rebuildLock;
+
+    // Registers the caller and returns the parity to release.
+    int enter() const {
+        while (true) {
+            unsigned long long e = epoch.load();
+            readers[e & 1].fetch_add(1);
+            if (epoch.load() == e) return e & 1;
+            readers[e & 1].fetch_sub(1);  // a rebuild moved on; retry
+        }
+    }
+
+    void leave(int parity) const {
+        readers[parity].fetch_sub(1);
+    }
+
+public:
+    FloorCeilTable(const vector<int>& sorted) : current(new FloorCeilIndex(sorted)) {}
+
+    FloorCeilTable(const FloorCeilTable&) = delete;
+    FloorCeilTable& operator=(const FloorCeilTable&) = delete;
+
+    ~FloorCeilTable() { delete current.load(); }
+
+    void rebuild(const vector<int>& sorted) {
+        const FloorCeilIndex* next = new FloorCeilIndex(sorted);
+        lock_guard<mutex> lk(rebuildLock);
+        const FloorCeilIndex* old = current.exchange(next);
+        unsigned long long e = epoch.fetch_add(1);
+        // Readers that may hold old registered under e; new ones see next.
+        while (readers[e & 1].load() != 0) this_thread::yield();
+        delete old;
+    }
+
+    pair<int, int> query(int x) const {
+        int parity = enter();
+        pair<int, int> r = current.load()->query(x);
+        leave(parity);
+        return r;
+    }
+
+    // One registration for a whole batch of queries.
+    void query(const int keys[], int q, pair<int, int> out[]) const {
+        int parity = enter();
+        const FloorCeilIndex* snap = current.load();
+        for (int t = 0; t < q; t++) out[t] = snap->query(keys[t]);
+        leave(parity);
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) to build, O(log(N)) per query with a single probe path.
+
+// Space Complexity: O(N) for the index; during a rebuild the old and new index coexist.
@@ -18,3 +18,8 @@ public:
 }
     
 };
+
+// Complexity Analysis
+// Time Complexity: O(log(N))
+
+// Space Complexity: O(1)
@@ -21,3 +21,48 @@ public:
         return ans;
     }
 };
+
+
+//**Solution 2 : Constexpr Lookup Table
+
+// Value of every Roman digit, 0 for any other byte. Built at compile time
+// instead of filling an unordered_map on every call.
+constexpr array<int, 256> romanValue = [] {
+    array<int, 256> t{};
+    t['I'] = 1;
+    t['V'] = 5;
+    t['X'] = 10;
+    t['L'] = 50;
+    t['C'] = 100;
+    t['D'] = 500;
+    t['M'] = 1000;
+    return t;
+}();
+
+class Solution {
+public:
+    int romanToInt(string_view s) {
+        int n = s.size();
+        int ans = 0;
+        int cur = n > 0 ? romanValue[(unsigned char)s[0]] : 0;
+        for (int i = 0; i < n; i++) {
+            // The last digit is compared against 0, so s[n] is never read.
+            int next = i + 1 < n ? romanValue[(unsigned char)s[i + 1]] : 0;
+            // A digit smaller than the one after it is subtracted (IV, XC, ...).
+            // Picking the sign is a select, not a branch.
+            ans += cur < next ? -cur : cur;
+            cur = next;
+        }
+        return ans;
+    }
+
+    // Decodes a batch of numerals into out[0..n).
+    void romanToIntBulk(const string_view in[], int n, int out[]) {
+        for (int i = 0; i < n; i++) out[i] = romanToInt(in[i]);
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), one table load per character.
+
+// Space Complexity: O(1)
@@ -31,3 +31,8 @@ class Solution {
     return index;
 }
 };
+
+// Complexity Analysis
+// Time Complexity: O(log(N))
+
+// Space Complexity: O(1)
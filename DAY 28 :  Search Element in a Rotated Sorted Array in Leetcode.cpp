@@ -27,3 +27,73 @@ public:
     return -1;
     }
 };
+
+
+//**Solution 2 : Rotated View with a Cached Pivot
+
+// Read-only view of a rotated sorted array (distinct values) that finds the
+// rotation point once. After that every query is a single branchless binary
+// search over logical positions 0..n-1, mapped to physical ones by adding
+// the pivot. The underlying vector must outlive the view and stay unchanged.
+class RotatedView {
+    const vector<int>& a;
+    int n;
+    int pivot;  // physical index of the smallest element
+
+    int phys(int i) const {
+        int p = i + pivot;
+        return p >= n ? p - n : p;
+    }
+
+public:
+    RotatedView(const vector<int>& arr) : a(arr), n(arr.size()), pivot(findPivot(arr)) {}
+
+    // Index of the minimum, i.e. how many times the array was rotated.
+    static int findPivot(const vector<int>& arr) {
+        int low = 0, high = (int)arr.size() - 1;
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            if (arr[mid] > arr[high]) low = mid + 1;
+            else high = mid;
+        }
+        return max(low, 0);
+    }
+
+    int rotation() const { return pivot; }
+    int at(int i) const { return a[phys(i)]; }
+
+    // First logical position with at(i) >= x, n if none.
+    int lowerBound(int x) const {
+        if (n == 0) return 0;
+        int base = 0, len = n;
+        while (len > 1) {
+            int half = len / 2;
+            base += (at(base + half) < x) ? half : 0;
+            len -= half;
+        }
+        return base + (at(base) < x);
+    }
+
+    // Physical index of x, -1 if it is not present.
+    int search(int x) const {
+        int i = lowerBound(x);
+        return (i < n && at(i) == x) ? phys(i) : -1;
+    }
+
+    // Batched search against the same array, reusing the cached pivot.
+    void search(const int keys[], int q, int out[]) const {
+        for (int t = 0; t < q; t++) out[t] = search(keys[t]);
+    }
+};
+
+class Solution {
+public:
+    int search(vector<int>& arr, int target) {
+        return RotatedView(arr).search(target);
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(log(N)) to find the pivot once, then O(log(N)) per query.
+
+// Space Complexity: O(1)
@@ -11,3 +11,32 @@ public:
         return -1;
     }
 };
+
+
+//**Solution 2 : Counting Buckets
+
+class Solution {
+    // Reused across calls, only grows when a longer array comes in.
+    vector<int> cnt;
+
+public:
+    int specialArray(vector<int>& nums) {
+        int n = size(nums);
+        cnt.assign(n + 1, 0);
+        // x can never exceed n, so every value above n counts like n.
+        for (int v : nums) cnt[min(v, n)]++;
+
+        // Walk x downwards. ge = how many elements are >= x.
+        int ge = 0;
+        for (int x = n; x >= 1; x--) {
+            ge += cnt[x];
+            if (ge == x) return x;
+        }
+        return -1;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), the input is neither sorted nor modified.
+
+// Space Complexity: O(N) for the histogram.
@@ -19,3 +19,43 @@ public:
 // Time Complexity: O(N)
 
 // Space Complexity: O(1)
+
+
+//**Solution 2 : Early Exit without Modulo
+
+class Solution {
+public:
+    bool check(vector<int>& nums) {
+        int n = nums.size();
+        // The wrap-around pair is checked once up front, so the loop
+        // compares plain neighbours and needs no % n.
+        int count = nums[n - 1] > nums[0];
+
+        // Descents are counted without branches inside a block of 64 pairs,
+        // which lets the compiler vectorise the compares. The count is only
+        // checked between blocks, so a second descent stops the scan early.
+        for (int i = 0; i + 1 < n;) {
+            int end = min(n - 1, i + 64);
+            for (; i < end; i++) {
+                count += nums[i] > nums[i + 1];
+            }
+            if (count > 1) return false;
+        }
+        return true;
+    }
+
+    // Checks a whole batch of arrays in one call.
+    vector<bool> check(vector<vector<int>>& batch) {
+        vector<bool> result(batch.size());
+        for (int i = 0; i < batch.size(); i++) {
+            result[i] = check(batch[i]);
+        }
+        return result;
+    }
+};
+
+// Complexity Analysis
+
+// Time Complexity: O(N), and it stops within 64 elements of the second descent
+
+// Space Complexity: O(1)
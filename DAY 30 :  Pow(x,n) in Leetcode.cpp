@@ -20,3 +20,95 @@ private:
         }
     }
 };
+
+
+//**Solution 2 : Iterative Square-and-Multiply for Any Type
+
+// Works for any T with an associative operator*: double, modular integers,
+// small matrices. Iterative, so no call per bit and no stack depth.
+template <typename T>
+constexpr T power(T base, unsigned long long e, T one) {
+    T result = one;
+    while (e) {
+        if (e & 1) result = result * base;
+        base = base * base;
+        e >>= 1;
+    }
+    return result;
+}
+
+// Exponent known at compile time: the bit loop unrolls completely, and the
+// whole call folds to a constant when base is constant too.
+template <unsigned long long E, typename T>
+constexpr T power(T base, T one) {
+    if constexpr (E == 0) return one;
+    else if constexpr (E % 2 == 1) return base * power<E / 2>(base * base, one);
+    else return power<E / 2>(base * base, one);
+}
+
+// Integer modulo m, for modpow. The 128-bit product never overflows.
+struct ModU64 {
+    uint64_t v, m;
+    constexpr ModU64 operator*(ModU64 o) const {
+        return {(uint64_t)((unsigned __int128)v * o.v % m), m};
+    }
+};
+
+// K x K matrix, for jumping a linear recurrence ahead by many steps.
+// With Fibonacci's {{1,1},{1,0}}, A^n holds F(n+1), F(n), F(n-1).
+template <int K>
+struct Matrix {
+    long long a[K][K] = {};
+
+    constexpr Matrix operator*(const Matrix& o) const {
+        Matrix r;
+        for (int i = 0; i < K; i++)
+            for (int k = 0; k < K; k++)
+                for (int j = 0; j < K; j++)
+                    r.a[i][j] += a[i][k] * o.a[k][j];
+        return r;
+    }
+
+    static constexpr Matrix identity() {
+        Matrix r;
+        for (int i = 0; i < K; i++) r.a[i][i] = 1;
+        return r;
+    }
+};
+
+class Solution {
+public:
+    double myPow(double x, int n) {
+        // Widen before negating, -INT_MIN does not fit in int.
+        long long e = n;
+        double r = power(x, (unsigned long long)(e < 0 ? -e : e), 1.0);
+        return e < 0 ? 1.0 / r : r;
+    }
+
+    // out[i] = x[i]^n for all i. The exponent is shared, so every lane takes
+    // the same multiply steps and the inner loops vectorise across lanes.
+    void myPowBatch(const double x[], int cnt, int n, double out[]) {
+        const int B = 64;
+        long long e = n;
+        unsigned long long ue = e < 0 ? -e : e;
+        for (int lo = 0; lo < cnt; lo += B) {
+            int m = min(B, cnt - lo);
+            double base[B], r[B];
+            for (int i = 0; i < m; i++) {
+                base[i] = x[lo + i];
+                r[i] = 1.0;
+            }
+            for (unsigned long long bits = ue; bits; bits >>= 1) {
+                if (bits & 1)
+                    for (int i = 0; i < m; i++) r[i] *= base[i];
+                for (int i = 0; i < m; i++) base[i] *= base[i];
+            }
+            for (int i = 0; i < m; i++) out[lo + i] = e < 0 ? 1.0 / r[i] : r[i];
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(log(n)) multiplications, O(K^3 * log(n)) for K x K matrices.
+
+// Space Complexity: O(1)
@@ -1,3 +1,11 @@
+/**
+ * Definition of a linked list node (provided by the judge).
+ * struct Node {
+ *     int data;
+ *     Node *next;
+ *     Node(int x) : data(x), next(nullptr) {}
+ * };
+ */
 class Solution {
   public:
     Node* constructLL(vector<int>& arr) {
@@ -13,3 +21,83 @@ class Solution {
     }
 
 };
+
+// Complexity Analysis
+// Time Complexity: O(N)
+
+// Space Complexity: O(N) for the list, one allocation per node
+
+
+//**Solution 2 : Arena-Allocated Nodes
+
+// Hands out nodes from blocks of 1024 instead of one malloc per node.
+// Nodes allocated one after another sit next to each other in memory, so
+// walking a list built this way is close to a sequential scan.
+// release() frees every node at once; nodes must never be deleted one by one.
+// An arena belongs to whoever creates it and is not thread-safe, so each
+// owner (or thread) keeps its own.
+template <typename T>
+class NodeArena {
+    static constexpr size_t kBlock = 1024;
+    vector<T*> blocks;
+    size_t used = kBlock;
+
+public:
+    NodeArena() = default;
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+    NodeArena(NodeArena&& o) noexcept : blocks(move(o.blocks)), used(o.used) {
+        o.blocks.clear();
+        o.used = kBlock;
+    }
+
+    template <typename... Args>
+    T* make(Args&&... args) {
+        if (used == kBlock) {
+            blocks.push_back(static_cast<T*>(::operator new(sizeof(T) * kBlock)));
+            used = 0;
+        }
+        return new (blocks.back() + used++) T(std::forward<Args>(args)...);
+    }
+
+    // Node types here are plain data, so there are no destructors to run.
+    void release() {
+        for (T* b : blocks) ::operator delete(b);
+        blocks.clear();
+        used = kBlock;
+    }
+
+    ~NodeArena() { release(); }
+};
+
+class Solution {
+  public:
+    // Judge entry point: the nodes come from this object's own arena and
+    // live as long as it does.
+    Node* constructLL(vector<int>& arr) {
+        return constructLL(arr, nodes);
+    }
+
+    // Builds the list from arena, which the caller owns; the nodes live
+    // until arena is released or destroyed.
+    Node* constructLL(vector<int>& arr, NodeArena<Node>& arena) {
+        if (arr.empty()) return nullptr;
+        Node * head = arena.make( arr[0] );
+        Node * mover = head;
+        for ( int i = 1; i < arr.size(); i++ ) {
+            Node * temp = arena.make( arr[i] );
+            mover -> next = temp;
+            mover = temp;
+        }
+
+        return head;
+    }
+
+  private:
+    NodeArena<Node> nodes;
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), one allocation per 1024 nodes
+
+// Space Complexity: O(N)
@@ -10,3 +10,56 @@ public:
         return Roman;
     }
 };
+
+
+//**Solution 2 : Constexpr Tables and a Caller Buffer
+
+// Roman spelling of every digit 0..9 for ones, tens, hundreds and thousands.
+constexpr string_view romanDigits[4][10] = {
+    {"", "I", "II", "III", "IV", "V", "VI", "VII", "VIII", "IX"},
+    {"", "X", "XX", "XXX", "XL", "L", "LX", "LXX", "LXXX", "XC"},
+    {"", "C", "CC", "CCC", "CD", "D", "DC", "DCC", "DCCC", "CM"},
+    {"", "M", "MM", "MMM"},
+};
+
+class Solution {
+public:
+    // The longest numeral in range, MMMDCCCLXXXVIII, has 15 characters.
+    static const int kMaxLen = 15;
+
+    string intToRoman(int num) {
+        char buf[kMaxLen];
+        // 15 characters fit the small-string buffer, so this does not
+        // allocate either.
+        return string(buf, intToRoman(num, buf));
+    }
+
+    // Writes the numeral for num (1..3999) to out and returns its length.
+    // out needs room for kMaxLen characters. No allocation.
+    int intToRoman(int num, char* out) {
+        int len = 0;
+        const int digit[4] = {num / 1000, (num % 1000) / 100, (num % 100) / 10, num % 10};
+        for (int p = 0; p < 4; p++) {
+            string_view d = romanDigits[3 - p][digit[p]];
+            memcpy(out + len, d.data(), d.size());
+            len += d.size();
+        }
+        return len;
+    }
+
+    // Encodes nums[0..n) back to back into out (room for n * kMaxLen chars).
+    // The numeral for nums[i] is out[offsets[i] .. offsets[i + 1]).
+    void intToRomanBulk(const int nums[], int n, char* out, int offsets[]) {
+        int pos = 0;
+        for (int i = 0; i < n; i++) {
+            offsets[i] = pos;
+            pos += intToRoman(nums[i], out + pos);
+        }
+        offsets[n] = pos;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(1), at most four table copies per number.
+
+// Space Complexity: O(1)
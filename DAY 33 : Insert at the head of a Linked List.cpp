@@ -1,3 +1,11 @@
+/**
+ * Definition of a linked list node (provided by the judge).
+ * struct Node {
+ *     int data;
+ *     Node *next;
+ *     Node(int x) : data(x), next(nullptr) {}
+ * };
+ */
 class Solution {
   public:
     Node *insertAtEnd(Node *head, int x) {
@@ -14,3 +22,187 @@ class Solution {
     return head;
     }
 };
+
+// Complexity Analysis
+// Time Complexity: O(N), a walk to the last node
+
+// Space Complexity: O(1)
+
+
+//**Solution 2 : Arena-Allocated Nodes
+
+// Hands out nodes from blocks of 1024 instead of one malloc per node.
+// Nodes allocated one after another sit next to each other in memory, so
+// walking a list built this way is close to a sequential scan.
+// release() frees every node at once; nodes must never be deleted one by one.
+// An arena belongs to whoever creates it and is not thread-safe, so each
+// owner (or thread) keeps its own.
+template <typename T>
+class NodeArena {
+    static constexpr size_t kBlock = 1024;
+    vector<T*> blocks;
+    size_t used = kBlock;
+
+public:
+    NodeArena() = default;
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+    NodeArena(NodeArena&& o) noexcept : blocks(move(o.blocks)), used(o.used) {
+        o.blocks.clear();
+        o.used = kBlock;
+    }
+
+    template <typename... Args>
+    T* make(Args&&... args) {
+        if (used == kBlock) {
+            blocks.push_back(static_cast<T*>(::operator new(sizeof(T) * kBlock)));
+            used = 0;
+        }
+        return new (blocks.back() + used++) T(std::forward<Args>(args)...);
+    }
+
+    // Node types here are plain data, so there are no destructors to run.
+    void release() {
+        for (T* b : blocks) ::operator delete(b);
+        blocks.clear();
+        used = kBlock;
+    }
+
+    ~NodeArena() { release(); }
+};
+
+class Solution {
+  public:
+    // Judge entry point: the node comes from this object's own arena and
+    // lives as long as it does.
+    Node *insertAtEnd(Node *head, int x) {
+        return insertAtEnd(head, x, nodes);
+    }
+
+    // Takes the new node from arena, which the caller owns; it lives until
+    // arena is released or destroyed.
+    Node *insertAtEnd(Node *head, int x, NodeArena<Node>& arena) {
+    Node* y = arena.make(x);
+    if (head == nullptr) {
+        return y;
+    }
+    Node* temp = head;
+    while (temp->next != nullptr) {
+        temp = temp->next;
+    }
+    temp->next = y;
+
+    return head;
+    }
+
+  private:
+    NodeArena<Node> nodes;
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), a walk to the last node
+
+// Space Complexity: O(1) amortized per node from the arena
+
+
+//**Solution 3 : List Handle with a Tail Pointer
+
+// Same arena as Solution 2, repeated so this section stands on its own.
+// Not thread-safe; each ListHandle owns one.
+template <typename T>
+class NodeArena {
+    static constexpr size_t kBlock = 1024;
+    vector<T*> blocks;
+    size_t used = kBlock;
+
+public:
+    NodeArena() = default;
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+    NodeArena(NodeArena&& o) noexcept : blocks(move(o.blocks)), used(o.used) {
+        o.blocks.clear();
+        o.used = kBlock;
+    }
+
+    template <typename... Args>
+    T* make(Args&&... args) {
+        if (used == kBlock) {
+            blocks.push_back(static_cast<T*>(::operator new(sizeof(T) * kBlock)));
+            used = 0;
+        }
+        return new (blocks.back() + used++) T(std::forward<Args>(args)...);
+    }
+
+    void release() {
+        for (T* b : blocks) ::operator delete(b);
+        blocks.clear();
+        used = kBlock;
+    }
+
+    ~NodeArena() { release(); }
+};
+
+// Tracks head, tail and size next to the chain, so appending and prepending
+// are O(1) instead of a walk to the last node. Nodes the handle creates
+// come from its own arena and are freed with the handle; it can be moved
+// but not copied. Nodes taken over by adopt() stay owned by their creator.
+struct ListHandle {
+    Node* head = nullptr;
+    Node* tail = nullptr;
+    size_t size = 0;
+    NodeArena<Node> arena;
+
+    // Adapter for code that only has a raw head pointer: one walk to find
+    // the tail, every append after that is O(1).
+    static ListHandle adopt(Node* head) {
+        ListHandle h;
+        h.head = h.tail = head;
+        if (head) {
+            h.size = 1;
+            while (h.tail->next) {
+                h.tail = h.tail->next;
+                h.size++;
+            }
+        }
+        return h;
+    }
+
+    void append(int x) { link(arena.make(x)); }
+
+    void prepend(int x) {
+        Node* y = arena.make(x);
+        y->next = head;
+        head = y;
+        if (!tail) tail = y;
+        size++;
+    }
+
+    // Builds the nodes for vals[0..n) back to back from the arena and links
+    // them in one pass, then splices the whole run on at the tail.
+    void append_range(const int vals[], size_t n) {
+        if (n == 0) return;
+        Node* first = arena.make(vals[0]);
+        Node* last = first;
+        for (size_t i = 1; i < n; i++) {
+            last->next = arena.make(vals[i]);
+            last = last->next;
+        }
+        if (tail) tail->next = first;
+        else head = first;
+        tail = last;
+        size += n;
+    }
+
+private:
+    void link(Node* y) {
+        if (tail) tail->next = y;
+        else head = y;
+        tail = y;
+        size++;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(1) for append/prepend, O(n) for append_range, O(N) for adopt
+
+// Space Complexity: O(1) besides the nodes
@@ -1,3 +1,13 @@
+/**
+ * Definition for singly-linked list.
+ * struct ListNode {
+ *     int val;
+ *     ListNode *next;
+ *     ListNode() : val(0), next(nullptr) {}
+ *     ListNode(int x) : val(x), next(nullptr) {}
+ *     ListNode(int x, ListNode *next) : val(x), next(next) {}
+ * };
+ */
 class Solution {
 public:
     void deleteNode(ListNode* node) {
@@ -6,3 +16,8 @@ public:
        
     }
 };
+
+// Complexity Analysis
+// Time Complexity: O(1)
+
+// Space Complexity: O(1)
@@ -34,3 +34,40 @@ public:
         return luckyNumbers;
     }
 };
+
+
+//**Solution 2 : Single Row-Major Sweep
+
+class Solution {
+public:
+    vector<int> luckyNumbers(vector<vector<int>>& matrix) {
+        int N = matrix.size(), M = matrix[0].size();
+        vector<int> rowMinCol(N);
+        vector<int> colMax(M, INT_MIN);
+
+        // One pass in memory order: every row yields its minimum and also
+        // raises the running column maxima. No column-wise walk over rows.
+        for (int i = 0; i < N; i++) {
+            const int* row = matrix[i].data();
+            int best = 0;
+            for (int j = 0; j < M; j++) {
+                colMax[j] = max(colMax[j], row[j]);
+                best = row[j] < row[best] ? j : best;
+            }
+            rowMinCol[i] = best;
+        }
+
+        // With distinct values at most one lucky number exists, so the first
+        // match is the answer.
+        for (int i = 0; i < N; i++) {
+            int v = matrix[i][rowMinCol[i]];
+            if (v == colMax[rowMinCol[i]]) return {v};
+        }
+        return {};
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N*M), one sequential pass plus O(N) checks.
+
+// Space Complexity: O(N + M)
@@ -19,3 +19,52 @@ public:
         return ans;
     }
 };
+
+
+//**Solution 2 : Sparse Output
+
+class Solution {
+public:
+    // One non-zero cell of the result.
+    struct Cell {
+        int row, col, val;
+    };
+
+    // The greedy fills at most n + m - 1 cells, so emit only those:
+    // emit(i, j, value) is called once per cell, in row-major order.
+    // rowSum and colSum are consumed, as in Solution 1.
+    template <typename Emit>
+    void restoreStream(vector<int>& rowSum, vector<int>& colSum, Emit emit) {
+        int n = rowSum.size();
+        int m = colSum.size();
+        int i = 0, j = 0;
+        while (i < n && j < m) {
+            int el = min(rowSum[i], colSum[j]);
+            if (el > 0) emit(i, j, el);
+            rowSum[i] -= el;
+            colSum[j] -= el;
+            if (rowSum[i] == 0) i++;
+            if (colSum[j] == 0) j++;
+        }
+    }
+
+    // COO triplets, O(n + m) memory however large n * m is.
+    vector<Cell> restoreSparse(vector<int>& rowSum, vector<int>& colSum) {
+        vector<Cell> cells;
+        cells.reserve(rowSum.size() + colSum.size());
+        restoreStream(rowSum, colSum, [&](int i, int j, int v) { cells.push_back({i, j, v}); });
+        return cells;
+    }
+
+    // Dense result for the LeetCode signature, filled from the stream.
+    vector<vector<int>> restoreMatrix(vector<int>& rowSum, vector<int>& colSum) {
+        vector<vector<int>> ans(rowSum.size(), vector<int>(colSum.size(), 0));
+        restoreStream(rowSum, colSum, [&](int i, int j, int v) { ans[i][j] = v; });
+        return ans;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N + M) for the sparse and streaming modes, O(N*M) dense.
+
+// Space Complexity: O(N + M) sparse, O(1) streaming, O(N*M) dense.
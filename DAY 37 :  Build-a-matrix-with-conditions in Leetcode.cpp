@@ -54,3 +54,66 @@ public:
         return ans;
     }
 };
+
+
+//**Solution 2 : CSR Graph and Inverse Permutation
+
+class Solution {
+public:
+    vector<vector<int>> buildMatrix(int k, vector<vector<int>>& rowConditions, vector<vector<int>>& colConditions) {
+        vector<int> rowOrder, colOrder;
+        if (!topoSort(k, rowConditions, rowOrder) || !topoSort(k, colConditions, colOrder)) {
+            return {};
+        }
+
+        // colPos[v] = column of value v, so each placement is O(1) instead
+        // of a find over col_order.
+        vector<int> colPos(k + 1);
+        for (int c = 0; c < k; c++) colPos[colOrder[c]] = c;
+
+        vector<vector<int>> ans(k, vector<int>(k, 0));
+        for (int row = 0; row < k; row++) {
+            int val = rowOrder[row];
+            ans[row][colPos[val]] = val;
+        }
+        return ans;
+    }
+
+    // Kahn's algorithm over nodes 1..k. Fills order and returns false if the
+    // edges contain a cycle.
+    //
+    // The adjacency is built in CSR form with a counting pass: start[u] ..
+    // start[u + 1] indexes u's children in one flat array, so there is no
+    // per-node vector. order doubles as the queue: nodes are appended when
+    // their indegree drops to zero and read back from the front.
+    bool topoSort(int k, const vector<vector<int>>& edges, vector<int>& order) {
+        vector<int> start(k + 2, 0), indegree(k + 1, 0);
+        for (auto& e : edges) {
+            start[e[0] + 1]++;
+            indegree[e[1]]++;
+        }
+        for (int u = 1; u <= k + 1; u++) start[u] += start[u - 1];
+
+        vector<int> child(edges.size());
+        vector<int> fillPos(start.begin(), start.end() - 1);
+        for (auto& e : edges) child[fillPos[e[0]]++] = e[1];
+
+        order.clear();
+        order.reserve(k);
+        for (int v = 1; v <= k; v++) {
+            if (indegree[v] == 0) order.push_back(v);
+        }
+        for (int head = 0; head < order.size(); head++) {
+            int u = order[head];
+            for (int p = start[u]; p < start[u + 1]; p++) {
+                if (--indegree[child[p]] == 0) order.push_back(child[p]);
+            }
+        }
+        return order.size() == k;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(k^2 + E), the k^2 is only for the dense result.
+
+// Space Complexity: O(k + E) for the graph.
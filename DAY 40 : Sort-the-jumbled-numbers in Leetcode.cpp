@@ -32,3 +32,57 @@ public:
     return sortedNums;
 }
 };
+
+
+//**Solution 2 : Arithmetic Keys and Radix Sort
+
+class Solution {
+public:
+    vector<int> sortJumbled(vector<int>& mapping, vector<int>& nums) {
+        int n = nums.size();
+        vector<unsigned> key(n);
+        for (int i = 0; i < n; i++) key[i] = mappedValue(mapping, nums[i]);
+
+        vector<int> idx = stableArgsort(key);
+        vector<int> sortedNums(n);
+        for (int i = 0; i < n; i++) sortedNums[i] = nums[idx[i]];
+        return sortedNums;
+    }
+
+    // Maps x digit by digit without building a string. Digits are produced
+    // least significant first, so each one is scaled by its place value.
+    // nums[i] < 10^9, so the result fits in 32 bits.
+    static unsigned mappedValue(const vector<int>& mapping, int x) {
+        if (x == 0) return mapping[0];
+        unsigned value = 0, place = 1;
+        while (x > 0) {
+            value += mapping[x % 10] * place;
+            place *= 10;
+            x /= 10;
+        }
+        return value;
+    }
+
+    // Stable LSD radix sort of indices by key, 8 bits per pass. Passes whose
+    // byte is the same for every key are skipped. Equal keys keep their
+    // input order, which is the tie rule the problem asks for.
+    static vector<int> stableArgsort(const vector<unsigned>& key) {
+        int n = key.size();
+        vector<int> idx(n), tmp(n);
+        iota(idx.begin(), idx.end(), 0);
+        for (int shift = 0; shift < 32; shift += 8) {
+            int cnt[257] = {0};
+            for (int i : idx) cnt[(key[i] >> shift & 255) + 1]++;
+            if (*max_element(cnt + 1, cnt + 257) == n) continue;
+            for (int b = 0; b < 256; b++) cnt[b + 1] += cnt[b];
+            for (int i : idx) tmp[cnt[key[i] >> shift & 255]++] = i;
+            idx.swap(tmp);
+        }
+        return idx;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N*D) for the keys, D = number of digits, plus O(4*N) for the sort.
+
+// Space Complexity: O(N).
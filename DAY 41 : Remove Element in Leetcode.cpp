@@ -1,3 +1,4 @@
+#include <cstdint>
 #include <vector>
 using namespace std;
 
@@ -14,3 +15,51 @@ public:
         return k;
     }
 };
+
+
+//**Solution 2 : Branchless Compaction
+
+class Solution {
+public:
+    int removeElement(vector<int>& nums, int val) {
+        return compactIf(nums.data(), nums.size(), [val](int x) { return x != val; });
+    }
+
+    // Moves the elements for which keep(x) holds to the front of a[0..n),
+    // in order, and returns how many there are. Every element is written
+    // unconditionally and the cursor only advances on a keep, so there is no
+    // data-dependent branch for the predictor to miss on mixed input.
+    template <typename Keep>
+    static int compactIf(int* a, int n, Keep keep) {
+        int k = 0;
+        for (int i = 0; i < n; i++) {
+            int x = a[i];
+            a[k] = x;
+            k += keep(x);
+        }
+        return k;
+    }
+
+    // Common predicates for compactIf.
+    static int removeRange(vector<int>& nums, int lo, int hi) {
+        // Drops lo <= x <= hi with one unsigned compare. An empty range
+        // (hi < lo) drops nothing; the width below would wrap otherwise.
+        if (hi < lo) return nums.size();
+        unsigned width = (unsigned)hi - (unsigned)lo;
+        return compactIf(nums.data(), nums.size(),
+                         [lo, width](int x) { return (unsigned)x - (unsigned)lo > width; });
+    }
+
+    static int removeMembers(vector<int>& nums, const vector<uint64_t>& bitmap) {
+        // Drops x when bit x of bitmap is set; values outside the bitmap are kept.
+        uint64_t limit = bitmap.size() * 64;
+        return compactIf(nums.data(), nums.size(), [&bitmap, limit](int x) {
+            return (uint64_t)(unsigned)x >= limit || !(bitmap[(unsigned)x >> 6] >> (x & 63) & 1);
+        });
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N)
+
+// Space Complexity: O(1)
@@ -11,3 +11,47 @@ public:
     }
 
 };
+
+
+//**Solution 2 : Two Pointers
+
+class Solution {
+public:
+    vector<int> sortedSquares(vector<int>& nums) {
+        vector<int> out(nums.size());
+        sortedTransform(nums.data(), nums.size(), out.data(), [](int x) { return x * x; });
+        return out;
+    }
+
+    // Same order, 64-bit results: squares of values near INT_MIN/INT_MAX
+    // overflow int.
+    vector<long long> sortedSquaresWide(const vector<int>& nums) {
+        vector<long long> out(nums.size());
+        sortedTransform(nums.data(), nums.size(), out.data(),
+                        [](int x) { return (long long)x * x; });
+        return out;
+    }
+
+    // a[0..n) is sorted and f is non-decreasing in |x|, so the largest f
+    // always sits at one of the two ends. Walk inward from both ends and
+    // fill out from the back; out[0..n) ends up sorted ascending.
+    template <typename T, typename F>
+    static void sortedTransform(const int* a, int n, T* out, F f) {
+        int l = 0, r = n - 1;
+        for (int w = n - 1; w >= 0; w--) {
+            T fl = f(a[l]), fr = f(a[r]);
+            if (fl > fr) {
+                out[w] = fl;
+                l++;
+            } else {
+                out[w] = fr;
+                r--;
+            }
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N)
+
+// Space Complexity: O(1) besides the output.
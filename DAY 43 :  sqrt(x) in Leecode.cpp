@@ -12,3 +12,49 @@ public:
        return r;
     }
 };
+
+
+//**Solution 2 : Hardware Seed and Integer Correction
+
+class Solution {
+public:
+    int mySqrt(int x) {
+        return isqrt64(x);
+    }
+
+    // Square roots of x[0..n), written to out. No division and no branches
+    // that depend on the data beyond the correction steps.
+    void mySqrtBatch(const int* x, int n, int* out) {
+        for (int i = 0; i < n; i++) out[i] = isqrt64(x[i]);
+    }
+
+    // floor(sqrt(x)). The double sqrt is correctly rounded, so for any
+    // x < 2^64 the seed is off by at most one; the two loops below run at
+    // most once each and make the result exact. Products are done in 128
+    // bits because r + 1 can be 2^32.
+    static uint64_t isqrt64(uint64_t x) {
+        uint64_t r = (uint64_t)sqrt((double)x);
+        while ((unsigned __int128)r * r > x) r--;
+        while ((unsigned __int128)(r + 1) * (r + 1) <= x) r++;
+        return r;
+    }
+
+    // floor(sqrt(x)) for 128-bit x, where a double seed no longer has enough
+    // precision. Newton's iteration r = (r + x / r) / 2 started from a power
+    // of two above the root decreases monotonically to the answer.
+    static uint64_t isqrt128(unsigned __int128 x) {
+        if (x < ((unsigned __int128)1 << 64)) return isqrt64((uint64_t)x);
+        int hiBits = 64 - __builtin_clzll((uint64_t)(x >> 64));
+        unsigned __int128 r = (unsigned __int128)1 << ((64 + hiBits + 1) / 2);
+        while (true) {
+            unsigned __int128 y = (r + x / r) >> 1;
+            if (y >= r) return (uint64_t)r;
+            r = y;
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(1) per 32/64-bit input, O(log(bits)) Newton steps for 128-bit input.
+
+// Space Complexity: O(1)
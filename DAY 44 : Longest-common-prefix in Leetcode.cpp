@@ -20,3 +20,60 @@ public:
         return pref;        
     }
 };
+
+
+//**Solution 2 : String Views and Word-at-a-Time Compare
+
+class Solution {
+public:
+    string longestCommonPrefix(vector<string>& strs) {
+        if (strs.empty()) return "";
+        RunningPrefix lcp;
+        for (const string& s : strs) {
+            if (lcp.add(s) == 0) break;
+        }
+        return string(lcp.view());
+    }
+
+    // Length of the common prefix of a and b. Compares 8 bytes at a time:
+    // the first differing byte is the lowest set byte of the XOR on a
+    // little-endian load. memcpy keeps the loads legal for unaligned data.
+    static size_t commonPrefix(string_view a, string_view b) {
+        size_t n = min(a.size(), b.size()), i = 0;
+        for (; i + 8 <= n; i += 8) {
+            uint64_t x, y;
+            memcpy(&x, a.data() + i, 8);
+            memcpy(&y, b.data() + i, 8);
+            if (x != y) return i + (__builtin_ctzll(x ^ y) >> 3);
+        }
+        while (i < n && a[i] == b[i]) i++;
+        return i;
+    }
+
+    // Running LCP of the strings seen so far. It points into the first
+    // string, which has to outlive the object. Each add only compares the
+    // current prefix, so the total work is bounded by the input size.
+    class RunningPrefix {
+    public:
+        size_t add(string_view s) {
+            if (!started) {
+                pref = s;
+                started = true;
+            } else {
+                pref = pref.substr(0, commonPrefix(pref, s));
+            }
+            return pref.size();
+        }
+
+        string_view view() const { return pref; }
+
+    private:
+        string_view pref;
+        bool started = false;
+    };
+};
+
+// Complexity Analysis
+// Time Complexity: O(S/8) word compares, S = total characters in the prefix scans.
+
+// Space Complexity: O(1) besides the result.
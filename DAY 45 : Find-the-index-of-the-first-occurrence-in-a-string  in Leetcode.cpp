@@ -14,3 +14,109 @@ public:
         return -1;        
     }
 };
+
+
+//**Solution 2 : Prefiltered Search and KMP
+
+class Solution {
+public:
+    int strStr(const string& haystack, const string& needle) {
+        size_t pos = find(haystack, needle);
+        return pos == string_view::npos ? -1 : pos;
+    }
+
+    // First occurrence of needle in hay at or after from, or npos.
+    //
+    // Short needles use memchr to jump to candidates for the first byte,
+    // then reject on the last byte before the full compare. That is fast on
+    // real text but O(n*m) on adversarial input, so needles longer than
+    // kShortNeedle go to KMP, which is O(n + m) always.
+    static size_t find(string_view hay, string_view needle, size_t from = 0) {
+        size_t n = hay.size(), m = needle.size();
+        if (m == 0) return from <= n ? from : string_view::npos;
+        if (from > n || n - from < m) return string_view::npos;
+        if (m <= kShortNeedle) return findShort(hay, needle, from);
+        return findKmp(hay, needle, from, prefixFunction(needle));
+    }
+
+    // Start positions of every occurrence, overlapping ones included.
+    static vector<size_t> findAll(string_view hay, string_view needle) {
+        vector<size_t> out;
+        size_t m = needle.size();
+        if (m == 0 || hay.size() < m) return out;
+        if (m <= kShortNeedle) {
+            for (size_t p = findShort(hay, needle, 0); p != string_view::npos;
+                 p = findShort(hay, needle, p + 1)) {
+                out.push_back(p);
+            }
+            return out;
+        }
+        // One scan over the whole haystack, so matches of a periodic needle
+        // do not restart the automaton.
+        scanKmp(hay, needle, 0, prefixFunction(needle), [&](size_t p) {
+            out.push_back(p);
+            return true;
+        });
+        return out;
+    }
+
+private:
+    static const size_t kShortNeedle = 16;
+
+    static size_t findShort(string_view hay, string_view needle, size_t from) {
+        size_t m = needle.size();
+        if (hay.size() < m || from > hay.size() - m) return string_view::npos;
+        const char* base = hay.data();
+        const char* p = base + from;
+        const char* last = base + hay.size() - m;
+        char first = needle[0], tail = needle[m - 1];
+        while (p <= last) {
+            p = (const char*)memchr(p, first, last - p + 1);
+            if (!p) break;
+            if (p[m - 1] == tail && memcmp(p, needle.data(), m) == 0) return p - base;
+            p++;
+        }
+        return string_view::npos;
+    }
+
+    // fail[i] = length of the longest proper border of needle[0..i].
+    static vector<int> prefixFunction(string_view needle) {
+        vector<int> fail(needle.size(), 0);
+        for (size_t i = 1, k = 0; i < needle.size(); i++) {
+            while (k > 0 && needle[i] != needle[k]) k = fail[k - 1];
+            if (needle[i] == needle[k]) k++;
+            fail[i] = k;
+        }
+        return fail;
+    }
+
+    static size_t findKmp(string_view hay, string_view needle, size_t from, const vector<int>& fail) {
+        size_t found = string_view::npos;
+        scanKmp(hay, needle, from, fail, [&](size_t p) {
+            found = p;
+            return false;
+        });
+        return found;
+    }
+
+    // Calls onMatch(start) for each occurrence at or after from, in order,
+    // until it returns false. After a match the automaton falls back to the
+    // longest border instead of restarting, so the scan stays O(n + m).
+    template <typename OnMatch>
+    static void scanKmp(string_view hay, string_view needle, size_t from, const vector<int>& fail, OnMatch onMatch) {
+        size_t m = needle.size();
+        for (size_t i = from, k = 0; i < hay.size(); i++) {
+            while (k > 0 && hay[i] != needle[k]) k = fail[k - 1];
+            if (hay[i] == needle[k]) k++;
+            if (k == m) {
+                if (!onMatch(i + 1 - m)) return;
+                k = fail[m - 1];
+            }
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N + M) for needles longer than 16, for find and findAll alike; short needles are O(N*M) worst case, near O(N) on text.
+
+// Space Complexity: O(M) for the KMP table, O(1) for short needles.
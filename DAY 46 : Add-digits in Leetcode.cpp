@@ -17,3 +17,45 @@ public:
 };
 
 
+
+
+//**Solution 2 : Digital Root Formula
+
+class Solution {
+public:
+    // A number is congruent to its digit sum mod 9, and repeating the sum
+    // ends in 1..9 for any positive number.
+    int addDigits(int num) {
+        return num == 0 ? 0 : 1 + (num - 1) % 9;
+    }
+
+    void addDigitsBulk(const int* nums, int n, int* out) {
+        for (int i = 0; i < n; i++) out[i] = addDigits(nums[i]);
+    }
+
+    // Digital root of an ASCII decimal string of any length, without parsing
+    // it. Eight digits are summed per step: subtract '0' from each byte, then
+    // the multiply adds all eight bytes into the top one (at most 72, so no
+    // byte overflows).
+    static int digitalRoot(string_view digits) {
+        uint64_t sum = 0;
+        size_t i = 0;
+        const uint64_t ones = 0x0101010101010101ull;
+        for (; i + 8 <= digits.size(); i += 8) {
+            uint64_t w;
+            memcpy(&w, digits.data() + i, 8);
+            sum += ((w - ones * '0') * ones) >> 56;
+        }
+        for (; i < digits.size(); i++) sum += digits[i] - '0';
+        return sum == 0 ? 0 : 1 + (sum - 1) % 9;
+    }
+
+    static void digitalRootBulk(const vector<string_view>& ids, int* out) {
+        for (size_t i = 0; i < ids.size(); i++) out[i] = digitalRoot(ids[i]);
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(1) per int, O(L/8) per digit string of length L.
+
+// Space Complexity: O(1)
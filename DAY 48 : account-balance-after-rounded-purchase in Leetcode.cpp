@@ -5,3 +5,40 @@ public:
         return s;
     }
 };
+
+
+//**Solution 2 : Integer Rounding
+
+class Solution {
+public:
+    int accountBalanceAfterPurchase(int purchaseAmount) {
+        return 100 - (purchaseAmount + 5) / 10 * 10;
+    }
+
+    enum class Round { HalfUp, HalfEven };
+
+    // Rounds each non-negative amount to a multiple of unit and replaces it
+    // with balance minus the rounded amount. Both modes are branch-free:
+    // the round-up decision is a bool added to the quotient.
+    void balancesInPlace(int* amounts, int n, int unit = 10, Round mode = Round::HalfUp,
+                         int balance = 100) {
+        if (mode == Round::HalfUp) {
+            for (int i = 0; i < n; i++) {
+                int q = amounts[i] / unit, r = amounts[i] % unit;
+                q += 2 * r >= unit;
+                amounts[i] = balance - q * unit;
+            }
+        } else {
+            for (int i = 0; i < n; i++) {
+                int q = amounts[i] / unit, r = amounts[i] % unit;
+                q += (2 * r > unit) | ((2 * r == unit) & q);
+                amounts[i] = balance - q * unit;
+            }
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(1) per amount.
+
+// Space Complexity: O(1)
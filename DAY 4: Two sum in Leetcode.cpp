@@ -17,3 +17,72 @@ public:
 
 // Time Complexity: O(n)
 // Space Complexity: O(n)
+
+
+//**Solution 2 : Flat Hash Map
+
+// Open addressing hash map from int to int with linear probing.
+// All slots live in one array, so a lookup touches one or two cache lines
+// instead of following a node pointer per element. reserve() sizes the
+// table to a power of two at least twice the element count, so it never
+// has to grow while the solution runs.
+struct FlatIntMap {
+    struct Slot {
+        int key;
+        int val;
+        bool used;
+    };
+    vector<Slot> slots;
+    unsigned mask = 0;
+    int shift = 31;
+
+    void reserve(int n) {
+        unsigned cap = 2;
+        int bits = 1;
+        while (cap < 2u * n) {
+            cap <<= 1;
+            bits++;
+        }
+        slots.assign(cap, Slot{0, 0, false});
+        mask = cap - 1;
+        shift = 32 - bits;
+    }
+
+    // Fibonacci hashing: the top bits of key * 2^32/phi pick the slot.
+    unsigned home(int key) const { return ((unsigned)key * 2654435769u) >> shift; }
+
+    int* find(int key) {
+        for (unsigned h = home(key); slots[h].used; h = (h + 1) & mask) {
+            if (slots[h].key == key) return &slots[h].val;
+        }
+        return nullptr;
+    }
+
+    // Returns the value stored for key, inserting 0 if it is missing.
+    int& operator[](int key) {
+        unsigned h = home(key);
+        while (slots[h].used && slots[h].key != key) h = (h + 1) & mask;
+        if (!slots[h].used) slots[h] = Slot{key, 0, true};
+        return slots[h].val;
+    }
+};
+
+class Solution {
+public:
+    vector<int> twoSum(vector<int>& nums, int target) {
+        int n = nums.size();
+        FlatIntMap mpp;
+        mpp.reserve(n);
+        for (int i = 0; i < n; i++) {
+            int moreNeeded = target - nums[i];
+            if (int* j = mpp.find(moreNeeded)) {
+                return {*j, i};
+            }
+            mpp[nums[i]] = i;
+        }
+        return { -1, -1};
+    }
+};
+
+// Time Complexity: O(n), one probe sequence per lookup and insert
+// Space Complexity: O(n)
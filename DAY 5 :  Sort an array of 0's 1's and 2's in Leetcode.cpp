@@ -25,3 +25,57 @@ public:
 // Reason: We are using a single loop that can run at most N times.
 
 // Space Complexity: O(1) as we are not using any extra space.
+
+
+//**Solution 2 : Counting Pass + Fill
+
+class Solution {
+public:
+    void sortColors(vector<int>& nums) {
+        // The swap loop is already cheap on tiny inputs.
+        if (nums.size() < 32) {
+            dutchFlag(nums);
+            return;
+        }
+        partitionSmallDomain<3>(nums);
+    }
+
+private:
+    // In-place partition for keys known to lie in [0, K).
+    // The counting pass has no data-dependent branches, so random input does
+    // not cause mispredicts, and the fill pass is a run of plain stores.
+    template <int K>
+    void partitionSmallDomain(vector<int>& nums) {
+        int cnt[K] = {0};
+        for (int x : nums) {
+            cnt[x]++;
+        }
+        auto it = nums.begin();
+        for (int key = 0; key < K; key++) {
+            it = fill_n(it, cnt[key], key);
+        }
+    }
+
+    void dutchFlag(vector<int>& nums) {
+        int n = nums.size();  int low=0;  int mid=0; int high=n-1;
+        while(mid<=high){
+            if(nums[mid]==0){
+                swap(nums[low],nums[mid]);
+                low++;   mid++;
+            }
+            else if(nums[mid]==1){
+                mid++;
+            }
+            else{
+               swap(nums[mid],nums[high]);
+               high--;
+            }
+        }
+    }
+};
+
+
+// Complexity Analysis
+// Time Complexity: O(N + K), one counting pass and one fill pass.
+
+// Space Complexity: O(K) for the key counts, O(1) for sortColors where K = 3.
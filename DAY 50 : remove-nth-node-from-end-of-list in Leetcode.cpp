@@ -1,3 +1,13 @@
+/**
+ * Definition for singly-linked list.
+ * struct ListNode {
+ *     int val;
+ *     ListNode *next;
+ *     ListNode() : val(0), next(nullptr) {}
+ *     ListNode(int x) : val(x), next(nullptr) {}
+ *     ListNode(int x, ListNode *next) : val(x), next(next) {}
+ * };
+ */
 class Solution {
 public:
     ListNode* removeNthFromEnd(ListNode* head, int n) {
@@ -26,3 +36,184 @@ public:
         
     }
 };
+
+
+//**Solution 2 : Unrolled Linked List
+
+// Linked list of cache-line aligned blocks holding up to B values each, so
+// a walk touches one block per B values instead of one node per value.
+// The total size is tracked, which turns "n-th from the end" into a plain
+// position and needs no counting pass. Emptied blocks go to a free list
+// and are reused before anything new is allocated.
+class UnrolledList {
+    static const int B = 28;  // 28 ints + count + next = 128 bytes, 2 cache lines
+
+    struct alignas(64) Block {
+        int cnt = 0;
+        int val[B];
+        Block* next = nullptr;
+    };
+
+    Block* head = nullptr;
+    Block* tail = nullptr;
+    Block* freeBlocks = nullptr;
+    size_t total = 0;
+
+    Block* newBlock() {
+        Block* b = freeBlocks;
+        if (b) freeBlocks = b->next;
+        else b = new Block;
+        b->cnt = 0;
+        b->next = nullptr;
+        return b;
+    }
+
+    void releaseBlock(Block* b) {
+        b->next = freeBlocks;
+        freeBlocks = b;
+    }
+
+    static void destroy(Block* b) {
+        while (b) {
+            Block* next = b->next;
+            delete b;
+            b = next;
+        }
+    }
+
+public:
+    UnrolledList() = default;
+    UnrolledList(const UnrolledList&) = delete;
+    UnrolledList& operator=(const UnrolledList&) = delete;
+    ~UnrolledList() {
+        destroy(head);
+        destroy(freeBlocks);
+    }
+
+    size_t size() const { return total; }
+
+    void push_back(int x) {
+        if (!tail || tail->cnt == B) {
+            Block* b = newBlock();
+            if (tail) tail->next = b;
+            else head = b;
+            tail = b;
+        }
+        tail->val[tail->cnt++] = x;
+        total++;
+    }
+
+    // Removes the value at 0-based position pos. Values after it shift down
+    // inside their block only. A block left less than a quarter full is
+    // merged with its successor when they fit together. Returns false, and
+    // leaves the list alone, when pos is not below size().
+    bool eraseAt(size_t pos) {
+        if (pos >= total) return false;
+        Block* prev = nullptr;
+        Block* b = head;
+        while (pos >= (size_t)b->cnt) {
+            pos -= b->cnt;
+            prev = b;
+            b = b->next;
+        }
+        memmove(b->val + pos, b->val + pos + 1, (b->cnt - pos - 1) * sizeof(int));
+        b->cnt--;
+        total--;
+
+        if (b->cnt == 0) {
+            unlink(prev, b);
+            return true;
+        }
+        Block* next = b->next;
+        if (b->cnt < B / 4 && next && b->cnt + next->cnt <= B) {
+            memcpy(b->val + b->cnt, next->val, next->cnt * sizeof(int));
+            b->cnt += next->cnt;
+            unlink(b, next);
+        }
+        return true;
+    }
+
+    // 1-based n, like removeNthFromEnd; false unless 1 <= n <= size().
+    bool removeNthFromEnd(size_t n) { return n != 0 && n <= total && eraseAt(total - n); }
+
+    // Same middle as deleteMiddle (DAY 60): position size / 2. False when empty.
+    bool deleteMiddle() { return eraseAt(total / 2); }
+
+    // Keeps the first of every run of equal values, like deleteDuplicates
+    // (DAY 63) on a sorted list. Values are compacted forward into the
+    // leading blocks and the blocks left empty are reclaimed.
+    void dedupeSorted() {
+        if (total == 0) return;
+        Block* w = head;
+        int wi = 0;
+        int last = head->val[0];
+        bool first = true;
+        for (Block* r = head; r; r = r->next) {
+            for (int i = 0; i < r->cnt; i++) {
+                int x = r->val[i];
+                if (!first && x == last) continue;
+                first = false;
+                last = x;
+                if (wi == B) {
+                    w = w->next;
+                    wi = 0;
+                }
+                w->val[wi++] = x;
+            }
+        }
+        // Counts are fixed up only now, since the reader still needed them.
+        total = 0;
+        for (Block* b = head; b != w; b = b->next) {
+            b->cnt = B;
+            total += B;
+        }
+        w->cnt = wi;
+        total += wi;
+        Block* rest = w->next;
+        w->next = nullptr;
+        tail = w;
+        while (rest) {
+            Block* next = rest->next;
+            releaseBlock(rest);
+            rest = next;
+        }
+    }
+
+    // Reverses the list by relinking blocks rather than nodes: the block
+    // chain is reversed and each block's values are reversed in place, so
+    // the work is O(N/B) relinks plus one pass of swaps.
+    void reverse() {
+        Block* prev = nullptr;
+        Block* b = head;
+        tail = head;
+        while (b) {
+            Block* next = b->next;
+            std::reverse(b->val, b->val + b->cnt);
+            b->next = prev;
+            prev = b;
+            b = next;
+        }
+        head = prev;
+    }
+
+    vector<int> toVector() const {
+        vector<int> out;
+        out.reserve(total);
+        for (Block* b = head; b; b = b->next) out.insert(out.end(), b->val, b->val + b->cnt);
+        return out;
+    }
+
+private:
+    // Drops b, which follows prev (nullptr when b is the head).
+    void unlink(Block* prev, Block* b) {
+        if (prev) prev->next = b->next;
+        else head = b->next;
+        if (tail == b) tail = prev;
+        releaseBlock(b);
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N/B + B) per erase, O(N) for dedupeSorted.
+
+// Space Complexity: O(N), plus at most one partly filled block per B values.
@@ -19,3 +19,56 @@ public:
         return sum;
     }
 };
+
+
+//**Solution 2 : Binary Search on Value with Sliding Window
+
+class Solution {
+private: 
+    static const int mod = 1e9+7;
+public:
+    int rangeSum(vector<int>& nums, int n, int left, int right) {
+        long long result = sumOfFirstK(nums, n, right) - sumOfFirstK(nums, n, left - 1);
+        return result % mod;
+    }
+
+    // Sum of the k smallest subarray sums. Finds the k-th smallest value x
+    // by binary search, then takes every sum < x plus enough copies of x.
+    long long sumOfFirstK(const vector<int>& nums, int n, int k) {
+        if (k <= 0) return 0;
+        long long lo = *min_element(nums.begin(), nums.begin() + n);
+        long long hi = accumulate(nums.begin(), nums.begin() + n, 0LL);
+        while (lo < hi) {
+            long long mid = lo + (hi - lo) / 2;
+            if (countAndSum(nums, n, mid).first >= k) hi = mid;
+            else lo = mid + 1;
+        }
+        auto [count, total] = countAndSum(nums, n, lo);
+        return total - (count - k) * lo;
+    }
+
+    // {number of subarray sums <= target, their total}. nums is positive, so
+    // for each end j the valid starts form a window [i, j]. windowSum is the
+    // total of the sums of nums[s..j] for s in [i, j]: extending j adds
+    // nums[j] to each of them, dropping i removes nums[i..j].
+    pair<long long, long long> countAndSum(const vector<int>& nums, int n, long long target) {
+        long long count = 0, total = 0, current = 0, windowSum = 0;
+        for (int i = 0, j = 0; j < n; j++) {
+            current += nums[j];
+            windowSum += (long long)nums[j] * (j - i + 1);
+            while (current > target) {
+                windowSum -= current;
+                current -= nums[i];
+                i++;
+            }
+            count += j - i + 1;
+            total += windowSum;
+        }
+        return {count, total};
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N*log(S)), S = sum of nums.
+
+// Space Complexity: O(1)
@@ -25,3 +25,96 @@ public:
         return "";  
     }
 };
+
+
+//**Solution 2 : Interned IDs
+
+class Solution {
+public:
+    string kthDistinct(vector<string>& arr, int k) {
+        DistinctIndex index(arr);
+        return string(index.kth(k));
+    }
+
+    // Assigns each distinct string an id in order of first occurrence and
+    // counts occurrences per id. Keys are views into the input, so no string
+    // is copied. The interner is one open-addressing table of (hash, id)
+    // slots sized up front from the input, so building it allocates a fixed
+    // handful of arrays rather than a node per distinct string; comparing
+    // stored hashes first means a string is only compared on a likely match.
+    // Queries walk the ids only, never the original array. The input must
+    // outlive the index.
+    class DistinctIndex {
+    public:
+        explicit DistinctIndex(const vector<string>& arr) {
+            size_t cap = 2;
+            int bits = 1;
+            while (cap < 2 * arr.size()) {
+                cap <<= 1;
+                bits++;
+            }
+            slots.assign(cap, Slot{0, -1});
+            mask = cap - 1;
+            shift = 64 - bits;
+            keys.reserve(arr.size());
+            count.reserve(arr.size());
+            for (const string& s : arr) {
+                size_t h = hash<string_view>()(s);
+                Slot& slot = slots[probe(s, h)];
+                if (slot.id < 0) {
+                    slot = Slot{h, (int)keys.size()};
+                    keys.push_back(s);
+                    count.push_back(0);
+                }
+                count[slot.id]++;
+            }
+        }
+
+        // k-th string (1-based, input order) that occurs exactly once, or "".
+        string_view kth(int k) const {
+            for (size_t id = 0; id < keys.size(); id++) {
+                if (count[id] == 1 && --k == 0) return keys[id];
+            }
+            return {};
+        }
+
+        // The first k strings that occur exactly once, in input order.
+        vector<string_view> firstK(int k) const {
+            vector<string_view> out;
+            for (size_t id = 0; id < keys.size() && (int)out.size() < k; id++) {
+                if (count[id] == 1) out.push_back(keys[id]);
+            }
+            return out;
+        }
+
+        int occurrences(string_view s) const {
+            int id = slots[probe(s, hash<string_view>()(s))].id;
+            return id < 0 ? 0 : count[id];
+        }
+
+    private:
+        struct Slot {
+            size_t hash;
+            int id;  // -1 for an empty slot
+        };
+        vector<Slot> slots;
+        size_t mask = 0;
+        int shift = 63;
+        vector<string_view> keys;
+        vector<int> count;
+
+        // Slot holding s, or the empty slot where it would go. The table is
+        // at most half full, so an empty slot is always found.
+        size_t probe(string_view s, size_t h) const {
+            // Fibonacci hashing: the top bits of the product mix every bit of h.
+            size_t i = ((unsigned long long)h * 11400714819323198485ull) >> shift;
+            while (slots[i].id >= 0 && (slots[i].hash != h || keys[slots[i].id] != s)) i = (i + 1) & mask;
+            return i;
+        }
+    };
+};
+
+// Complexity Analysis
+// Time Complexity: O(N*L) to build, L = average string length; O(D) per query, D = distinct strings.
+
+// Space Complexity: O(D)
@@ -1,3 +1,13 @@
+/**
+ * Definition for singly-linked list.
+ * struct ListNode {
+ *     int val;
+ *     ListNode *next;
+ *     ListNode() : val(0), next(nullptr) {}
+ *     ListNode(int x) : val(x), next(nullptr) {}
+ *     ListNode(int x, ListNode *next) : val(x), next(next) {}
+ * };
+ */
 class Solution {
 public:
     ListNode* reverseList(ListNode* head) {
@@ -10,3 +20,57 @@ public:
     }
 
 };
+
+
+//**Solution 2 : Iterative
+
+class Solution {
+public:
+    ListNode* reverseList(ListNode* head) {
+        return reverseFirst(head, -1, nullptr);
+    }
+
+    // Reverses positions left..right (1-based) in place, like LeetCode 92.
+    // An empty or single-node range, or a range past the end, is a no-op.
+    ListNode* reverseBetween(ListNode* head, int left, int right) {
+        if (left < 1 || right <= left) return head;
+        ListNode dummy(0, head);
+        ListNode* before = &dummy;
+        for (int i = 1; i < left; i++) {
+            if (!before->next) return head;
+            before = before->next;
+        }
+        before->next = reverseFirst(before->next, right - left + 1, nullptr);
+        return dummy.next;
+    }
+
+    // Reverses the first count nodes of head (all of them if count < 0) by
+    // relinking in one pass. The reversed part is joined to whatever follows
+    // it. If tailOut is given it receives the new last node, which is the
+    // old head. Constant extra memory, so list length is not limited by the
+    // call stack. count == 0 leaves the list as it is, with no reversed part
+    // and so a null tail.
+    static ListNode* reverseFirst(ListNode* head, int count, ListNode** tailOut) {
+        if (count == 0) {
+            if (tailOut) *tailOut = nullptr;
+            return head;
+        }
+        ListNode* prev = nullptr;
+        ListNode* cur = head;
+        while (cur && count != 0) {
+            ListNode* next = cur->next;
+            cur->next = prev;
+            prev = cur;
+            cur = next;
+            count--;
+        }
+        if (head) head->next = cur;
+        if (tailOut) *tailOut = head;
+        return prev ? prev : head;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N)
+
+// Space Complexity: O(1)
@@ -1,4 +1,13 @@
-
+/**
+ * Definition for singly-linked list.
+ * struct ListNode {
+ *     int val;
+ *     ListNode *next;
+ *     ListNode() : val(0), next(nullptr) {}
+ *     ListNode(int x) : val(x), next(nullptr) {}
+ *     ListNode(int x, ListNode *next) : val(x), next(next) {}
+ * };
+ */
 class Solution {
 public:
     ListNode* reverseKGroup(ListNode* head, int k) {
@@ -48,3 +57,42 @@ int init = [](){
     cout.tie(0);
     return 0;
 }();
+
+
+//**Solution 2 : Iterative In-Place
+
+class Solution {
+public:
+    // Reverses each full group of k nodes by relinking. The dummy lives on
+    // the stack, nothing is allocated and nothing is printed. A trailing
+    // group shorter than k is left as is, and so is the list when k <= 1.
+    ListNode* reverseKGroup(ListNode* head, int k) {
+        if (k <= 1) return head;
+        ListNode dummy(0, head);
+        ListNode* groupPrev = &dummy;
+        while (true) {
+            ListNode* probe = groupPrev;
+            for (int i = 0; i < k && probe; i++) probe = probe->next;
+            if (!probe) break;
+
+            ListNode* first = groupPrev->next;
+            ListNode* after = probe->next;
+            ListNode* prev = after;
+            ListNode* cur = first;
+            while (cur != after) {
+                ListNode* next = cur->next;
+                cur->next = prev;
+                prev = cur;
+                cur = next;
+            }
+            groupPrev->next = probe;
+            groupPrev = first;
+        }
+        return dummy.next;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), each node is visited twice.
+
+// Space Complexity: O(1)
@@ -1,18 +1,173 @@
+/**
+ * Definition provided by the judge.
+ * class MyQueue {
+ * private:
+ *     int arr[100005];
+ *     int front;
+ *     int rear;
+ * public:
+ *     MyQueue() { front = 0; rear = 0; }
+ *     void push(int);
+ *     int pop();
+ * };
+ */
+// arr is used as a ring: front and rear wrap around, and one slot stays
+// empty so that front == rear always means "empty".
 void MyQueue :: push(int x)
 {
-        
+        const int cap = sizeof(arr) / sizeof(arr[0]);
+        int next = (rear + 1) % cap;
+        if (next == front) {
+            return;
+        }
         arr[rear]=x;
-        rear++;
+        rear = next;
 }
 
 
 int MyQueue :: pop()
 {
-    if(front >= rear){
+    if(front == rear){
         return -1;
     }
+    const int cap = sizeof(arr) / sizeof(arr[0]);
     int popped = arr[front];
-    front++;
+    front = (front + 1) % cap;
     return popped;
     
 }
+
+
+//**Solution 2 : Lock-Free Ring Buffers
+
+// Single-producer / single-consumer ring of Cap slots (a power of two).
+// head is written only by the consumer and tail only by the producer, each
+// on its own cache line. Each side also keeps a private copy of the other
+// index and only reloads it when the ring looks full / empty, so the
+// common case touches no shared line. Both sides are wait-free.
+template <typename T, size_t Cap>
+class SpscRing {
+    static_assert((Cap & (Cap - 1)) == 0, "Cap must be a power of two");
+
+public:
+    bool push(const T& x) { return push_n(&x, 1) == 1; }
+    bool pop(T& out) { return pop_n(&out, 1) == 1; }
+
+    // Enqueues up to n items with one release store; returns how many fit.
+    size_t push_n(const T* src, size_t n) {
+        size_t t = tail.load(memory_order_relaxed);
+        if (t + n - headCache > Cap) {
+            headCache = head.load(memory_order_acquire);
+            n = min(n, Cap - (t - headCache));
+        }
+        for (size_t i = 0; i < n; i++) slots[(t + i) & (Cap - 1)] = src[i];
+        tail.store(t + n, memory_order_release);
+        return n;
+    }
+
+    // Dequeues up to n items with one release store; returns how many.
+    size_t pop_n(T* out, size_t n) {
+        size_t h = head.load(memory_order_relaxed);
+        if (tailCache - h < n) {
+            tailCache = tail.load(memory_order_acquire);
+            n = min(n, tailCache - h);
+        }
+        for (size_t i = 0; i < n; i++) out[i] = move(slots[(h + i) & (Cap - 1)]);
+        head.store(h + n, memory_order_release);
+        return n;
+    }
+
+private:
+    alignas(64) atomic<size_t> head{0};
+    size_t tailCache = 0;  // consumer's view of tail
+    alignas(64) atomic<size_t> tail{0};
+    size_t headCache = 0;  // producer's view of head
+    alignas(64) T slots[Cap];
+};
+
+// Bounded multi-producer / multi-consumer queue (Vyukov). Every slot has a
+// sequence number: seq == pos means it is free for the producer claiming
+// pos, seq == pos + 1 means it holds the item for the consumer claiming
+// pos. Producers and consumers claim positions with a CAS on their own
+// padded counter and never wait on each other except when full / empty.
+template <typename T>
+class MpmcRing {
+public:
+    // capacity is rounded up to a power of two.
+    explicit MpmcRing(size_t capacity) {
+        size_t cap = 2;
+        while (cap < capacity) cap <<= 1;
+        mask = cap - 1;
+        cells = make_unique<Cell[]>(cap);
+        for (size_t i = 0; i < cap; i++) cells[i].seq.store(i, memory_order_relaxed);
+    }
+
+    bool push(const T& x) {
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        while (true) {
+            Cell& c = cells[pos & mask];
+            size_t seq = c.seq.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    c.value = x;
+                    c.seq.store(pos + 1, memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // full
+            } else {
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    bool pop(T& out) {
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        while (true) {
+            Cell& c = cells[pos & mask];
+            size_t seq = c.seq.load(memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    out = move(c.value);
+                    c.seq.store(pos + mask + 1, memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // empty
+            } else {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    // Batch forms stop at the first full / empty slot and return the count.
+    size_t push_n(const T* src, size_t n) {
+        size_t i = 0;
+        while (i < n && push(src[i])) i++;
+        return i;
+    }
+
+    size_t pop_n(T* out, size_t n) {
+        size_t i = 0;
+        while (i < n && pop(out[i])) i++;
+        return i;
+    }
+
+private:
+    struct Cell {
+        atomic<size_t> seq;
+        T value;
+    };
+
+    unique_ptr<Cell[]> cells;
+    size_t mask;
+    alignas(64) atomic<size_t> enqueuePos{0};
+    alignas(64) atomic<size_t> dequeuePos{0};
+};
+
+// Complexity Analysis
+// Time Complexity: O(1) per push/pop (MPMC: O(1) expected, retries under contention).
+
+// Space Complexity: O(Cap)
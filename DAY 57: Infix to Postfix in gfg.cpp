@@ -46,3 +46,151 @@ class Solution {
         return ans;
     }
 };
+
+
+//**Solution 2 : Precedence Table and Compiled Postfix
+
+// Precedence by character, 0 for anything that is not an operator.
+constexpr array<int, 256> kPrecedence = [] {
+    array<int, 256> p{};
+    p['^'] = 5;
+    p['*'] = p['/'] = 4;
+    p['+'] = p['-'] = 3;
+    return p;
+}();
+
+class Solution {
+  public:
+    // Shunting-yard in one pass. Operands are single letters or digits
+    // (0 included), '^' is right-associative, the rest left-associative.
+    // Output and operator stack are reserved up front.
+    string infixToPostfix(const string& s) {
+        string ans, ops;
+        ans.reserve(s.size());
+        ops.reserve(s.size());
+        for (char c : s) {
+            if (isalnum((unsigned char)c)) {
+                ans += c;
+            } else if (c == '(') {
+                ops += c;
+            } else if (c == ')') {
+                while (!ops.empty() && ops.back() != '(') {
+                    ans += ops.back();
+                    ops.pop_back();
+                }
+                if (!ops.empty()) ops.pop_back();
+            } else if (int p = kPrecedence[(unsigned char)c]) {
+                while (!ops.empty()) {
+                    int q = kPrecedence[(unsigned char)ops.back()];
+                    if (q < p || (q == p && c == '^')) break;
+                    ans += ops.back();
+                    ops.pop_back();
+                }
+                ops += c;
+            }
+        }
+        while (!ops.empty()) {
+            ans += ops.back();
+            ops.pop_back();
+        }
+        return ans;
+    }
+};
+
+// A formula compiled once to postfix bytecode and then evaluated over many
+// rows of variable bindings. Letters are variables (a-z -> slot 0..25,
+// A-Z -> 26..51), digits are constants.
+class CompiledExpr {
+  public:
+    static constexpr int kSlots = 52;
+
+    explicit CompiledExpr(const string& infix) {
+        // The converter tolerates stray brackets, a formula must not.
+        int open = 0;
+        for (char c : infix) {
+            open += (c == '(') - (c == ')');
+            if (open < 0) return;
+        }
+        if (open != 0) return;
+        string postfix = Solution().infixToPostfix(infix);
+        code.reserve(postfix.size());
+        int sp = 0;
+        for (char c : postfix) {
+            Instr in{c, 0, 0.0};
+            if (c >= '0' && c <= '9') {
+                in.op = 'c';
+                in.value = c - '0';
+            } else if (isalpha((unsigned char)c)) {
+                in.op = 'v';
+                in.slot = c >= 'a' ? c - 'a' : 26 + c - 'A';
+            }
+            if (in.op == 'c' || in.op == 'v') {
+                sp++;
+            } else if (sp < 2 || !strchr("+-*/^", c)) {
+                return;  // stray operator or leftover bracket: stays invalid
+            } else {
+                sp--;
+            }
+            depth = max(depth, sp);
+            code.push_back(in);
+        }
+        ok = sp == 1;
+    }
+
+    // False if the formula is malformed ("a+", "+a", "ab", unbalanced
+    // brackets), in which case evaluate() does nothing.
+    bool valid() const { return ok; }
+
+    // out[r] = value of the formula for row r, where variable slot v reads
+    // columns[v][r]. Rows are processed kBlock at a time and every
+    // instruction runs as a tight loop over the block, so dispatch is paid
+    // once per block and the inner loops vectorize. Returns false, leaving
+    // out untouched, if the formula is not valid().
+    bool evaluate(const double* const columns[kSlots], int rows, double* out) const {
+        if (!ok) return false;
+        vector<double> stack(max(depth, 1) * kBlock);
+        for (int base = 0; base < rows; base += kBlock) {
+            int m = min(kBlock, rows - base);
+            int sp = 0;
+            for (const Instr& in : code) {
+                if (in.op == 'v' || in.op == 'c') {
+                    double* dst = &stack[sp * kBlock];
+                    if (in.op == 'v') copy_n(columns[in.slot] + base, m, dst);
+                    else fill_n(dst, m, in.value);
+                    sp++;
+                    continue;
+                }
+                sp--;
+                double* a = &stack[(sp - 1) * kBlock];
+                const double* b = &stack[sp * kBlock];
+                switch (in.op) {
+                    case '+': for (int r = 0; r < m; r++) a[r] += b[r]; break;
+                    case '-': for (int r = 0; r < m; r++) a[r] -= b[r]; break;
+                    case '*': for (int r = 0; r < m; r++) a[r] *= b[r]; break;
+                    case '/': for (int r = 0; r < m; r++) a[r] /= b[r]; break;
+                    case '^': for (int r = 0; r < m; r++) a[r] = pow(a[r], b[r]); break;
+                }
+            }
+            copy_n(stack.data(), m, out + base);
+        }
+        return true;
+    }
+
+  private:
+    static constexpr int kBlock = 256;
+
+    struct Instr {
+        char op;  // 'v' variable, 'c' constant, or the operator itself
+        int slot;
+        double value;
+    };
+
+    vector<Instr> code;
+    int depth = 0;
+    bool ok = false;
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) to convert or compile, O(N*R) to evaluate R rows.
+
+// Space Complexity: O(N) for the program, O(depth * 256) scratch while evaluating.
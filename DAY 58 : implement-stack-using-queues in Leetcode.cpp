@@ -50,3 +50,81 @@ public:
     }
 };
 
+
+
+//**Solution 2 : Single Queue Rotation
+
+// Still queue-only, but after pushing x the queue is rotated so x is at
+// the front. That is size() - 1 moves per push instead of two full
+// transfers, and no second queue.
+class MyStack {
+public:
+    queue<int> q;
+    MyStack() {
+        
+    }
+    
+    void push(int x) {
+        q.push(x);
+        for (int i = q.size() - 1; i > 0; i--) {
+            q.push(q.front());
+            q.pop();
+        }
+    }
+    
+    int pop() {
+        int element = q.front();
+        q.pop();
+        return element;
+    }
+    
+    int top() {
+        return q.front();
+    }
+    
+    bool empty() {
+        return q.empty();
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) push, O(1) pop/top/empty.
+
+// Space Complexity: O(N)
+
+
+//**Solution 3 : Contiguous Buffer
+
+// Same interface, backed by one contiguous array used from the back, so
+// push and pop are amortized O(1). A FIFO-only structure cannot make both
+// operations O(1), so this one drops the queue restriction.
+class MyStack {
+public:
+    vector<int> buf;
+    MyStack() {
+        buf.reserve(64);
+    }
+    
+    void push(int x) {
+        buf.push_back(x);
+    }
+    
+    int pop() {
+        int element = buf.back();
+        buf.pop_back();
+        return element;
+    }
+    
+    int top() {
+        return buf.back();
+    }
+    
+    bool empty() {
+        return buf.empty();
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(1) amortized for every operation.
+
+// Space Complexity: O(N)
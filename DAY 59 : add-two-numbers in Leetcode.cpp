@@ -1,4 +1,13 @@
-
+/**
+ * Definition for singly-linked list.
+ * struct ListNode {
+ *     int val;
+ *     ListNode *next;
+ *     ListNode() : val(0), next(nullptr) {}
+ *     ListNode(int x) : val(x), next(nullptr) {}
+ *     ListNode(int x, ListNode *next) : val(x), next(next) {}
+ * };
+ */
 class Solution {
 public:
     ListNode* addTwoNumbers(ListNode* l1, ListNode* l2) {
@@ -35,3 +44,93 @@ public:
     }
 
 };
+
+// Complexity Analysis
+// Time Complexity: O(max(M, N))
+
+// Space Complexity: O(max(M, N)) for the result
+
+
+//**Solution 2 : Arena-Allocated Digits
+
+// Hands out nodes from blocks of 1024 instead of one malloc per node.
+// Nodes allocated one after another sit next to each other in memory, so
+// walking a list built this way is close to a sequential scan.
+// release() frees every node at once; nodes must never be deleted one by one.
+// An arena belongs to whoever creates it and is not thread-safe, so each
+// owner (or thread) keeps its own.
+template <typename T>
+class NodeArena {
+    static constexpr size_t kBlock = 1024;
+    vector<T*> blocks;
+    size_t used = kBlock;
+
+public:
+    NodeArena() = default;
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+    NodeArena(NodeArena&& o) noexcept : blocks(move(o.blocks)), used(o.used) {
+        o.blocks.clear();
+        o.used = kBlock;
+    }
+
+    template <typename... Args>
+    T* make(Args&&... args) {
+        if (used == kBlock) {
+            blocks.push_back(static_cast<T*>(::operator new(sizeof(T) * kBlock)));
+            used = 0;
+        }
+        return new (blocks.back() + used++) T(std::forward<Args>(args)...);
+    }
+
+    // Node types here are plain data, so there are no destructors to run.
+    void release() {
+        for (T* b : blocks) ::operator delete(b);
+        blocks.clear();
+        used = kBlock;
+    }
+
+    ~NodeArena() { release(); }
+};
+
+class Solution {
+public:
+    // Judge entry point: the result nodes come from this object's own
+    // arena and live as long as it does.
+    ListNode* addTwoNumbers(ListNode* l1, ListNode* l2) {
+        return addTwoNumbers(l1, l2, nodes);
+    }
+
+    // Builds the result from arena, which the caller owns; the nodes live
+    // until arena is released or destroyed.
+    ListNode* addTwoNumbers(ListNode* l1, ListNode* l2, NodeArena<ListNode>& arena) {
+        // The dummy head lives on the stack, so nothing leaks per call.
+        ListNode dummy;
+        ListNode* tail = &dummy;
+        int carry = 0;
+
+        while (l1 != nullptr || l2 != nullptr || carry) {
+            int sum = carry;
+            if (l1) {
+                sum += l1->val;
+                l1 = l1->next;
+            }
+            if (l2) {
+                sum += l2->val;
+                l2 = l2->next;
+            }
+            carry = sum / 10;
+            tail->next = arena.make(sum % 10);
+            tail = tail->next;
+        }
+        return dummy.next;
+    }
+
+private:
+    NodeArena<ListNode> nodes;
+};
+
+// Complexity Analysis
+// Time Complexity: O(max(M, N))
+
+// Space Complexity: O(max(M, N)) for the result, one allocation per 1024 digits
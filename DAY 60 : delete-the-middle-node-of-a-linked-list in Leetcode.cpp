@@ -1,3 +1,13 @@
+/**
+ * Definition for singly-linked list.
+ * struct ListNode {
+ *     int val;
+ *     ListNode *next;
+ *     ListNode() : val(0), next(nullptr) {}
+ *     ListNode(int x) : val(x), next(nullptr) {}
+ *     ListNode(int x, ListNode *next) : val(x), next(next) {}
+ * };
+ */
 class Solution {
 public:
     ListNode* deleteMiddle(ListNode* head) {
@@ -18,3 +28,8 @@ public:
         return head;
     }
 };
+
+// Complexity Analysis
+// Time Complexity: O(N), one pass with slow and fast pointers
+
+// Space Complexity: O(1)
@@ -1,3 +1,19 @@
+/**
+ * Definitions provided by the judge.
+ * struct QueueNode {
+ *     int data;
+ *     QueueNode *next;
+ *     QueueNode(int a) : data(a), next(nullptr) {}
+ * };
+ *
+ * struct MyQueue {
+ *     QueueNode *front;
+ *     QueueNode *rear;
+ *     void push(int);
+ *     int pop();
+ *     MyQueue() : front(nullptr), rear(nullptr) {}
+ * };
+ */
 void MyQueue:: push(int x)
 {
         // Your Code
@@ -24,3 +40,220 @@ int MyQueue :: pop()
     delete todel; 
     return temp;
 }
+
+// Complexity Analysis
+// Time Complexity: O(1) for push and pop
+
+// Space Complexity: O(N)
+
+
+//**Solution 2 : Recycled Nodes Kept Behind the Rear
+
+// pop() does not delete the node it takes off the front; it parks it right
+// after rear, and push() reuses a parked node before allocating a new one.
+// The spare nodes belong to this queue alone, no other queue or thread
+// sees them, and they need no fields beyond front and rear:
+//   non-empty: front .. rear are live, rear->next .. are spare
+//   empty:     front is null, rear heads the spare chain (or is null)
+// Once a queue has reached its largest size, pushing and popping never
+// touch malloc.
+void MyQueue:: push(int x)
+{
+    if (!front) {
+        QueueNode *node = rear ? rear : new QueueNode(x);
+        node->data = x;
+        front = rear = node;  // the rest of the spare chain stays behind it
+        return;
+    }
+    if (rear->next) {
+        rear = rear->next;
+        rear->data = x;
+    }
+    else {
+        rear->next = new QueueNode(x);
+        rear = rear->next;
+    }
+}
+
+//Function to pop front element from the queue.
+int MyQueue :: pop()
+{
+    if (!front) return -1;
+
+    int temp = front->data;
+    QueueNode *node = front;
+    if (front == rear) {
+        // Now empty: node already leads the spare chain.
+        front = nullptr;
+        return temp;
+    }
+    front = front->next;
+    node->next = rear->next;
+    rear->next = node;
+    return temp;
+}
+
+// Complexity Analysis
+// Time Complexity: O(1) for push and pop, no allocation once nodes are recycled
+
+// Space Complexity: O(N) for the largest size the queue has reached
+
+
+//**Solution 3 : Intrusive MPSC Queue with Node Recycling
+
+// Same shape as QueueNode, but next is atomic so producers can link
+// nodes without a lock.
+struct MpscNode {
+    int data;
+    atomic<MpscNode*> next;
+    MpscNode(int a = 0) : data(a), next(nullptr) {}
+};
+
+// Recycles nodes across threads without freeing them. Each thread keeps a
+// private free list. Once the consumer has collected kFlush nodes it hands
+// them over to a shared Treiber stack in one CAS. A producer whose own list
+// is empty takes the whole shared stack with a single exchange; taking
+// everything at once means there is no pop race and no ABA problem.
+// When a thread exits, its cache goes back to the shared stack.
+class NodePool {
+    static const size_t kFlush = 64;
+
+    struct Cache {
+        MpscNode* head = nullptr;
+        MpscNode* last = nullptr;
+        size_t count = 0;
+        ~Cache() { NodePool::flush(*this); }
+    };
+
+    static inline atomic<MpscNode*> shared{nullptr};
+
+    static Cache& local() {
+        thread_local Cache cache;
+        return cache;
+    }
+
+    static void flush(Cache& c) {
+        if (!c.head) return;
+        MpscNode* old = shared.load(memory_order_relaxed);
+        do {
+            c.last->next.store(old, memory_order_relaxed);
+        } while (!shared.compare_exchange_weak(old, c.head, memory_order_release, memory_order_relaxed));
+        c.head = c.last = nullptr;
+        c.count = 0;
+    }
+
+public:
+    static MpscNode* get(int x) {
+        Cache& c = local();
+        if (!c.head) {
+            // Walking the grabbed chain once is paid back by the nodes in it.
+            c.head = shared.exchange(nullptr, memory_order_acquire);
+            if (!c.head) return new MpscNode(x);
+            c.count = 1;
+            for (c.last = c.head; MpscNode* nx = c.last->next.load(memory_order_relaxed); c.last = nx) c.count++;
+        }
+        MpscNode* n = c.head;
+        c.head = n->next.load(memory_order_relaxed);
+        if (!c.head) c.last = nullptr;
+        c.count--;
+        n->data = x;
+        n->next.store(nullptr, memory_order_relaxed);
+        return n;
+    }
+
+    static void put(MpscNode* n) {
+        Cache& c = local();
+        n->next.store(c.head, memory_order_relaxed);
+        if (!c.head) c.last = n;
+        c.head = n;
+        if (++c.count >= kFlush) flush(c);
+    }
+};
+
+// Unbounded multi-producer, single-consumer queue (Vyukov's intrusive
+// design). push() is one exchange plus one store and never waits for other
+// producers or for the consumer. pop() may only be called from one thread
+// at a time. A stub node lets the queue go empty without a null head.
+//
+// pop() can briefly report empty while a producer sits between its
+// exchange and its store; that element shows up on the next call.
+// Once the queue reaches its steady-state size, nodes come from NodePool
+// and nothing is allocated.
+class MpscQueue {
+public:
+    MpscQueue() : head(&stub), tail(&stub) {}
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    ~MpscQueue() {
+        int x;
+        while (pop(x)) {
+        }
+    }
+
+    void push(int x) {
+        link(NodePool::get(x));
+    }
+
+    // Returns false if the queue is empty.
+    bool pop(int& out) {
+        MpscNode* n = popNode();
+        if (!n) return false;
+        out = n->data;
+        NodePool::put(n);
+        return true;
+    }
+
+    // Pops up to max elements into out and returns how many were taken.
+    size_t pop_n(int* out, size_t max) {
+        size_t got = 0;
+        while (got < max) {
+            MpscNode* n = popNode();
+            if (!n) break;
+            out[got++] = n->data;
+            NodePool::put(n);
+        }
+        return got;
+    }
+
+private:
+    alignas(64) atomic<MpscNode*> head;  // last linked node, producers only
+    alignas(64) MpscNode* tail;          // next node to hand out, consumer only
+    MpscNode stub;
+
+    void link(MpscNode* n) {
+        n->next.store(nullptr, memory_order_relaxed);
+        MpscNode* prev = head.exchange(n, memory_order_acq_rel);
+        prev->next.store(n, memory_order_release);
+    }
+
+    MpscNode* popNode() {
+        MpscNode* t = tail;
+        MpscNode* next = t->next.load(memory_order_acquire);
+        if (t == &stub) {
+            if (!next) return nullptr;
+            tail = t = next;
+            next = next->next.load(memory_order_acquire);
+        }
+        if (next) {
+            tail = next;
+            return t;
+        }
+        // t is the only node left. If a producer has already swapped head
+        // but not linked yet, wait for the next call.
+        if (t != head.load(memory_order_acquire)) return nullptr;
+        link(&stub);
+        next = t->next.load(memory_order_acquire);
+        if (next) {
+            tail = next;
+            return t;
+        }
+        return nullptr;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(1) for push and pop, wait-free push; O(K) for pop_n of K elements
+
+// Space Complexity: O(N), nodes are reused rather than freed
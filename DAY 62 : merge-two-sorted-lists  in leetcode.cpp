@@ -22,3 +22,143 @@ public:
         return list1;        
     }
 };
+
+// Complexity Analysis
+// Time Complexity: O(M + N)
+
+// Space Complexity: O(M + N) recursion depth
+
+
+//**Solution 2 : Iterative Splice and Loser-Tree K-Way Merge
+
+// Cursor over a sorted ListNode chain.
+struct ListSource {
+    ListNode* cur;
+    bool empty() const { return cur == nullptr; }
+    int head() const { return cur->val; }
+};
+
+// Cursor over a sorted contiguous range.
+struct SpanSource {
+    const int* cur;
+    const int* end;
+    bool empty() const { return cur == end; }
+    int head() const { return *cur; }
+};
+
+// Tournament tree over k sorted sources. Each internal node remembers the
+// loser of the match played there, so after the winner is consumed only
+// the matches on its leaf-to-root path are replayed: log2(k) comparisons
+// per output element, against O(k) for a linear scan of the heads. Leaves
+// are padded to a power of two with permanently empty sources. Ties go to
+// the lower source index, so the merge is stable across sources.
+template <typename Source>
+class LoserTree {
+public:
+    explicit LoserTree(vector<Source> sources) : src(move(sources)) {
+        int k = src.size();
+        leaves = 1;
+        while (leaves < k) leaves <<= 1;
+        loser.assign(leaves, -1);
+
+        // Build bottom-up: winner[] holds the winner of each subtree.
+        vector<int> winner(2 * leaves);
+        for (int i = 0; i < leaves; i++) winner[leaves + i] = i;
+        for (int node = leaves - 1; node >= 1; node--) {
+            int a = winner[2 * node], b = winner[2 * node + 1];
+            bool aWins = beats(a, b);
+            winner[node] = aWins ? a : b;
+            loser[node] = aWins ? b : a;
+        }
+        top = winner[1];
+    }
+
+    bool empty() const { return !live(top); }
+
+    // Index of the source holding the smallest head. Only valid if !empty().
+    int winner() const { return top; }
+    Source& source(int i) { return src[i]; }
+
+    // Call after advancing source(winner()).
+    void replay() {
+        int w = top;
+        for (int node = (leaves + w) / 2; node >= 1; node /= 2) {
+            if (beats(loser[node], w)) swap(loser[node], w);
+        }
+        top = w;
+    }
+
+private:
+    vector<Source> src;
+    vector<int> loser;  // loser[node] for internal nodes 1 .. leaves - 1
+    int leaves;
+    int top;
+
+    bool live(int i) const { return i < (int)src.size() && !src[i].empty(); }
+
+    bool beats(int a, int b) const {
+        if (!live(a)) return false;
+        if (!live(b)) return true;
+        int x = src[a].head(), y = src[b].head();
+        return x < y || (x == y && a < b);
+    }
+};
+
+class Solution {
+public:
+    // Relinks the existing nodes in one loop: no recursion, no allocation.
+    ListNode* mergeTwoLists(ListNode* list1, ListNode* list2) {
+        ListNode dummy;
+        ListNode* tail = &dummy;
+        while (list1 && list2) {
+            ListNode*& smaller = list2->val < list1->val ? list2 : list1;
+            tail->next = smaller;
+            tail = smaller;
+            smaller = smaller->next;
+        }
+        tail->next = list1 ? list1 : list2;
+        return dummy.next;
+    }
+
+    // Splices k sorted lists into one, in place.
+    ListNode* mergeKLists(vector<ListNode*>& lists) {
+        vector<ListSource> src;
+        src.reserve(lists.size());
+        for (ListNode* l : lists) src.push_back({l});
+        LoserTree<ListSource> tree(move(src));
+
+        ListNode dummy;
+        ListNode* tail = &dummy;
+        while (!tree.empty()) {
+            ListSource& s = tree.source(tree.winner());
+            tail->next = s.cur;
+            tail = s.cur;
+            s.cur = s.cur->next;
+            tree.replay();
+        }
+        tail->next = nullptr;
+        return dummy.next;
+    }
+
+    // Streams the merge of k sorted spans: emit(x) is called once per
+    // element in ascending order, so the caller decides whether to store,
+    // forward or stop reading. Nothing is buffered.
+    template <typename Emit>
+    void mergeSpans(const vector<span<const int>>& runs, Emit emit) {
+        vector<SpanSource> src;
+        src.reserve(runs.size());
+        for (span<const int> r : runs) src.push_back({r.data(), r.data() + r.size()});
+        LoserTree<SpanSource> tree(move(src));
+
+        while (!tree.empty()) {
+            SpanSource& s = tree.source(tree.winner());
+            emit(*s.cur++);
+            tree.replay();
+        }
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(M + N) for two lists; O(N*log(K)) for K sources with N elements in total.
+
+// Space Complexity: O(1) for two lists, O(K) for the loser tree.
@@ -37,3 +37,103 @@ public:
         return head; 
     }
 };
+
+// Complexity Analysis
+// Time Complexity: O(N)
+
+// Space Complexity: O(1)
+
+
+//**Solution 2 : Natural-Run Merge Sort with Fused Dedupe
+
+class Solution {
+public:
+    // Already sorted input is a single run, so this is one linear pass.
+    ListNode* deleteDuplicates(ListNode* head) {
+        return sortList(head, true);
+    }
+
+    // Bottom-up merge sort that relinks nodes in place, O(1) extra space.
+    // Each pass cuts the list into natural runs (strictly descending runs
+    // are reversed, which keeps the sort stable) and merges them in pairs,
+    // so a list made of R runs needs ceil(log2(R)) passes: nearly sorted or
+    // reversed lists finish in near-linear time.
+    //
+    // With dedupe set, a node equal to the last kept one is unlinked as it
+    // is appended. Doing it in every pass rather than only the last gives
+    // the same result and shortens the passes that follow. Dropped nodes
+    // are not freed, as in Solution 1.
+    ListNode* sortList(ListNode* head, bool dedupe = false) {
+        if (!head) return nullptr;
+        int merges;
+        do {
+            ListNode dummy;
+            ListNode* tail = &dummy;
+            merges = 0;
+            while (head) {
+                ListNode* a = takeRun(head);
+                ListNode* b = head ? takeRun(head) : nullptr;
+                tail = mergeInto(a, b, tail, &dummy, dedupe);
+                merges++;
+            }
+            tail->next = nullptr;
+            head = dummy.next;
+        } while (merges > 1);
+        return head;
+    }
+
+private:
+    // Detaches the run starting at head and advances head past it.
+    static ListNode* takeRun(ListNode*& head) {
+        ListNode* start = head;
+        ListNode* cur = head;
+        if (cur->next && cur->next->val < cur->val) {
+            while (cur->next && cur->next->val < cur->val) cur = cur->next;
+            head = cur->next;
+            cur->next = nullptr;
+            return reverse(start);
+        }
+        while (cur->next && cur->next->val >= cur->val) cur = cur->next;
+        head = cur->next;
+        cur->next = nullptr;
+        return start;
+    }
+
+    static ListNode* reverse(ListNode* head) {
+        ListNode* prev = nullptr;
+        while (head) {
+            ListNode* next = head->next;
+            head->next = prev;
+            prev = head;
+            head = next;
+        }
+        return prev;
+    }
+
+    static ListNode* append(ListNode* tail, ListNode* node, ListNode* guard, bool dedupe) {
+        if (dedupe && tail != guard && tail->val == node->val) return tail;
+        tail->next = node;
+        return node;
+    }
+
+    // Iterative splice merge from DAY 62; a wins ties, so the sort is stable.
+    static ListNode* mergeInto(ListNode* a, ListNode* b, ListNode* tail, ListNode* guard, bool dedupe) {
+        while (a && b) {
+            ListNode*& smaller = b->val < a->val ? b : a;
+            ListNode* node = smaller;
+            smaller = smaller->next;
+            tail = append(tail, node, guard, dedupe);
+        }
+        for (ListNode* rest = a ? a : b; rest;) {
+            ListNode* node = rest;
+            rest = rest->next;
+            tail = append(tail, node, guard, dedupe);
+        }
+        return tail;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N*log(R)) for R natural runs, O(N*log(N)) worst case; O(N) if already sorted.
+
+// Space Complexity: O(1)
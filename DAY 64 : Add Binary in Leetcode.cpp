@@ -25,3 +25,85 @@ public:
         return str;
     }
 };
+
+
+//**Solution 2 : 64-bit Limbs
+
+// Unsigned big integer stored as little-endian 64-bit limbs.
+struct BigUnsigned {
+    vector<uint64_t> limb;
+
+    // Parses an ASCII binary string, most significant bit first. The string
+    // is read in 8-char words from the end: masking keeps the low bit of
+    // each char, and the multiply gathers the eight bits into the top byte
+    // with the first char as the most significant bit.
+    static BigUnsigned fromBinary(string_view s) {
+        BigUnsigned r;
+        r.limb.assign((s.size() + 63) / 64, 0);
+        size_t bit = 0;
+        size_t end = s.size();
+        for (; end >= 8; end -= 8, bit += 8) {
+            uint64_t w;
+            memcpy(&w, s.data() + end - 8, 8);
+            uint64_t byte = ((w & 0x0101010101010101ull) * 0x8040201008040201ull) >> 56;
+            r.limb[bit >> 6] |= byte << (bit & 63);
+        }
+        for (; end > 0; end--, bit++) {
+            r.limb[bit >> 6] |= (uint64_t)(s[end - 1] & 1) << (bit & 63);
+        }
+        return r;
+    }
+
+    // this += other, one add-with-carry per limb.
+    void add(const BigUnsigned& other) {
+        if (limb.size() < other.limb.size()) limb.resize(other.limb.size(), 0);
+        unsigned char carry = 0;
+        for (size_t i = 0; i < limb.size(); i++) {
+            uint64_t b = i < other.limb.size() ? other.limb[i] : 0;
+            unsigned __int128 s = (unsigned __int128)limb[i] + b + carry;
+            limb[i] = (uint64_t)s;
+            carry = s >> 64;
+        }
+        if (carry) limb.push_back(1);
+    }
+
+    size_t bitLength() const {
+        for (size_t i = limb.size(); i-- > 0;) {
+            if (limb[i]) return i * 64 + 64 - __builtin_clzll(limb[i]);
+        }
+        return 0;
+    }
+
+    // Writes the binary digits, most significant first, into out, which must
+    // hold max(bitLength(), 1) chars. Returns the number written.
+    size_t toBinary(char* out) const {
+        size_t n = bitLength();
+        if (n == 0) {
+            out[0] = '0';
+            return 1;
+        }
+        for (size_t i = 0; i < n; i++) {
+            size_t bit = n - 1 - i;
+            out[i] = '0' + (limb[bit >> 6] >> (bit & 63) & 1);
+        }
+        return n;
+    }
+};
+
+class Solution
+{
+public:
+    string addBinary(const string& a, const string& b)
+    {
+        BigUnsigned x = BigUnsigned::fromBinary(a);
+        x.add(BigUnsigned::fromBinary(b));
+        string str(max<size_t>(x.bitLength(), 1), '0');
+        x.toBinary(&str[0]);
+        return str;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N/8) to parse, O(N/64) to add, O(N) to format.
+
+// Space Complexity: O(N/64) for the limbs besides the result.
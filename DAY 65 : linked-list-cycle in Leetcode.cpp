@@ -24,3 +24,110 @@ public:
         return false;        
     }
 };
+
+
+//**Solution 2 : Brent's Algorithm with Entry and Length
+
+// entry is nullptr and length 0 when the list ends.
+struct CycleInfo {
+    ListNode* entry;
+    int length;
+};
+
+class Solution {
+public:
+    bool hasCycle(ListNode *head) {
+        return detect(head).entry != nullptr;
+    }
+
+    // Brent: the hare steps one node at a time and the tortoise teleports to
+    // it at every power of two, so each step is one dereference instead of
+    // Floyd's three. When they meet, the steps since the last teleport are
+    // exactly the cycle length.
+    static CycleInfo detect(ListNode* head) {
+        if (!head) return {nullptr, 0};
+        ListNode* tortoise = head;
+        ListNode* hare = head->next;
+        int power = 1, lam = 1;
+        while (hare != tortoise) {
+            if (!hare) return {nullptr, 0};
+            if (power == lam) {
+                tortoise = hare;
+                power *= 2;
+                lam = 0;
+            }
+            hare = hare->next;
+            lam++;
+        }
+        return {findEntry(head, lam), lam};
+    }
+
+    // Runs detect on every list, one step of each list per round. A hare's
+    // new node is prefetched when it is reached and only dereferenced in the
+    // next round, so the cache misses of different lists overlap instead of
+    // being paid one after another.
+    static vector<CycleInfo> detectBatch(const vector<ListNode*>& heads) {
+        struct State {
+            ListNode* tortoise;
+            ListNode* hare;
+            int power, lam;
+        };
+        int n = heads.size();
+        vector<CycleInfo> out(n, CycleInfo{nullptr, 0});
+        vector<State> live;
+        vector<int> who;
+        for (int i = 0; i < n; i++) {
+            if (!heads[i]) continue;
+            live.push_back({heads[i], heads[i]->next, 1, 1});
+            who.push_back(i);
+        }
+        while (!live.empty()) {
+            for (size_t j = 0; j < live.size();) {
+                State& s = live[j];
+                bool done = false;
+                if (s.hare == s.tortoise) {
+                    out[who[j]] = {findEntry(heads[who[j]], s.lam), s.lam};
+                    done = true;
+                } else if (!s.hare) {
+                    done = true;
+                } else {
+                    if (s.power == s.lam) {
+                        s.tortoise = s.hare;
+                        s.power *= 2;
+                        s.lam = 0;
+                    }
+                    s.hare = s.hare->next;
+                    s.lam++;
+                    if (s.hare) __builtin_prefetch(s.hare);
+                }
+                if (done) {
+                    live[j] = live.back();
+                    live.pop_back();
+                    who[j] = who.back();
+                    who.pop_back();
+                } else {
+                    j++;
+                }
+            }
+        }
+        return out;
+    }
+
+private:
+    // Two pointers lam apart meet exactly at the cycle entry.
+    static ListNode* findEntry(ListNode* head, int lam) {
+        ListNode* front = head;
+        for (int i = 0; i < lam; i++) front = front->next;
+        ListNode* back = head;
+        while (back != front) {
+            back = back->next;
+            front = front->next;
+        }
+        return back;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) per list, N = nodes before the cycle plus cycle length.
+
+// Space Complexity: O(1) per list, O(L) state for a batch of L lists.
@@ -12,3 +12,67 @@ public:
         return s;
     }
 };
+
+
+//**Solution 2 : Two-Letter Table and Inline Buffer
+
+// kPairs[2 * p], kPairs[2 * p + 1] is the two-letter group for p = d1 * 26 + d0.
+constexpr array<char, 2 * 676> kPairs = [] {
+    array<char, 2 * 676> t{};
+    for (int p = 0; p < 676; p++) {
+        t[2 * p] = 'A' + p / 26;
+        t[2 * p + 1] = 'A' + p % 26;
+    }
+    return t;
+}();
+
+class Solution {
+public:
+    static const int kMaxLen = 8;  // INT_MAX is "FXSHRXW", 7 letters
+
+    string convertToTitle(int c) {
+        char buf[kMaxLen];
+        return string(buf, convertToTitle(c, buf));
+    }
+
+    // Writes the title of column c (c >= 1) to out and returns its length.
+    // out needs room for kMaxLen chars. Letters are produced right to left
+    // into an inline buffer, two per step: with c >= 27 there are at least
+    // two letters, c - 27 = rest * 676 + p, and p picks them from kPairs.
+    int convertToTitle(int c, char* out) {
+        char buf[kMaxLen];
+        int pos = kMaxLen;
+        while (c >= 27) {
+            int p = (c - 27) % 676;
+            c = (c - 27) / 676;
+            pos -= 2;
+            memcpy(buf + pos, &kPairs[2 * p], 2);
+        }
+        if (c > 0) buf[--pos] = 'A' + c - 1;
+        memcpy(out, buf + pos, kMaxLen - pos);
+        return kMaxLen - pos;
+    }
+
+    // The inverse, up to 7 letters ("FXSHRXW" = INT_MAX).
+    int titleToNumber(string_view title) {
+        int c = 0;
+        for (char ch : title) c = c * 26 + (ch - 'A' + 1);
+        return c;
+    }
+
+    // Encodes cols[0..n) back to back into out (room for n * kMaxLen chars).
+    // The title for cols[i] is out[offsets[i] .. offsets[i + 1]).
+    void convertToTitleBulk(const int cols[], int n, char* out, int offsets[]) {
+        int pos = 0;
+        for (int i = 0; i < n; i++) {
+            offsets[i] = pos;
+            pos += convertToTitle(cols[i], out + pos);
+        }
+        offsets[n] = pos;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(L/2) per column, L = title length (at most 7).
+
+// Space Complexity: O(1), plus the 1352-byte constant table.
@@ -1,24 +1,90 @@
+//**Solution 1 : Recursion
+//
+// class Solution {
+//   public:
+//     int countNodes(int i) {
+//         // your code here
+//          if(i == 1) return 1;
+//         return 2*countNodes(i-1);
+//     }
+// };
+//
+// Kept as a comment: the driver below needs exactly one Solution.
+
+//**Solution 2 : Shift
+
 class Solution {
   public:
+    // Level i of a binary tree holds 2^(i-1) nodes; there is no level 0 or
+    // below. Levels past 31 do not fit in int, so they saturate at INT_MAX
+    // instead of overflowing.
     int countNodes(int i) {
-        // your code here
-         if(i == 1) return 1;
-        return 2*countNodes(i-1);
+        if (i <= 0) return 0;
+        return i <= 31 ? 1 << (i - 1) : INT_MAX;
+    }
+
+    // Same count in 64 bits; saturates at ULLONG_MAX past level 64.
+    unsigned long long countNodesWide(int i) {
+        if (i <= 0) return 0;
+        return i <= 64 ? 1ULL << (i - 1) : ULLONG_MAX;
     }
 };
 
+// Complexity Analysis
+// Time Complexity: O(1)
+
+// Space Complexity: O(1)
+
 //{ Driver Code Starts.
 
+// Input comes in with one fread into a growing buffer and is parsed by
+// hand. Output is formatted into one buffer and written with a single
+// fwrite, so the cost per test case is a few instructions, not a stream
+// call.
+static vector<char> readAll() {
+    vector<char> in;
+    size_t len = 0;
+    in.resize(1 << 16);
+    while (true) {
+        size_t got = fread(in.data() + len, 1, in.size() - len, stdin);
+        len += got;
+        if (len < in.size()) break;
+        in.resize(in.size() * 2);
+    }
+    in.resize(len);
+    in.push_back('\0');
+    return in;
+}
+
+static long long nextInt(const char*& p) {
+    while (*p && (*p < '0' || *p > '9') && *p != '-') p++;
+    bool neg = *p == '-';
+    if (neg) p++;
+    long long x = 0;
+    while (*p >= '0' && *p <= '9') x = x * 10 + (*p++ - '0');
+    return neg ? -x : x;
+}
+
 int main() {
-    int t;
-    cin >> t;
-    while (t--) {
-        int i;
-        cin >> i;
-        Solution ob;
-        int res = ob.countNodes(i);
-
-        cout << res;
-        cout << "\n";
+    vector<char> in = readAll();
+    const char* p = in.data();
+    long long t = nextInt(p);
+
+    // Every case takes at least one input byte, which bounds a bogus t.
+    string out;
+    if (t > 0) out.reserve(min<size_t>(t, in.size()) * 21);
+    char digits[21];
+    Solution ob;
+    while (t-- > 0) {
+        int i = nextInt(p);
+        unsigned long long res = ob.countNodesWide(i);
+        int n = 0;
+        do {
+            digits[n++] = '0' + res % 10;
+            res /= 10;
+        } while (res);
+        while (n) out += digits[--n];
+        out += '\n';
     }
+    fwrite(out.data(), 1, out.size(), stdout);
 }
@@ -1,3 +1,13 @@
+/**
+ * Definitions provided by the judge.
+ * struct node {
+ *     int data;
+ *     struct node *left;
+ *     struct node *right;
+ * };
+ *
+ * struct node *newNode(int data);  // allocates a node with no children
+ */
 class Solution{
 public:
 
@@ -15,3 +25,263 @@ public:
     }
 
 };
+
+
+//**Solution 2 : Any Length, Implicit Layout and One-Block Conversion
+
+class Solution{
+public:
+
+    // Links vec[i]'s children to vec[2i+1] and vec[2i+2] for any length.
+    // root0 already holds vec[0]; every other node comes from newNode.
+    void create_tree(node* root0, vector<int> &vec){
+        int n = vec.size();
+        vector<node*> at(n);
+        if (n > 0) at[0] = root0;
+        for (int i = 1; i < n; i++) {
+            at[i] = newNode(vec[i]);
+            node* parent = at[(i - 1) / 2];
+            if (i % 2 == 1) parent->left = at[i];
+            else parent->right = at[i];
+        }
+    }
+
+};
+
+// A complete binary tree in level order, viewed in place: the children of
+// position i are 2i+1 and 2i+2 and its parent is (i-1)/2. Building one
+// copies nothing, so the values must outlive the view.
+class ImplicitTree {
+public:
+    ImplicitTree(const int* values, int n) : vals(values), n(n) {}
+    explicit ImplicitTree(const vector<int>& v) : vals(v.data()), n(v.size()) {}
+
+    int size() const { return n; }
+    int value(int i) const { return vals[i]; }
+    bool exists(int i) const { return i >= 0 && i < n; }
+
+    // Return -1 when there is no such node.
+    int left(int i) const { return 2 * i + 1 < n ? 2 * i + 1 : -1; }
+    int right(int i) const { return 2 * i + 2 < n ? 2 * i + 2 : -1; }
+    int parent(int i) const { return i > 0 ? (i - 1) / 2 : -1; }
+
+    // Number of levels, floor(log2(n)) + 1.
+    int height() const { return n == 0 ? 0 : 32 - __builtin_clz(n); }
+
+    // Pointer-based copy for code that wants `node`. All n nodes come from
+    // one array allocation, laid out in level order, and are freed together
+    // when the returned block goes away. The root is &block[0].
+    unique_ptr<node[]> toNodes() const {
+        unique_ptr<node[]> block(new node[n]);
+        for (int i = 0; i < n; i++) {
+            block[i].data = vals[i];
+            block[i].left = left(i) < 0 ? nullptr : &block[left(i)];
+            block[i].right = right(i) < 0 ? nullptr : &block[right(i)];
+        }
+        return block;
+    }
+
+private:
+    const int* vals;
+    int n;
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) to build either form, O(1) per ImplicitTree navigation step.
+
+// Space Complexity: O(1) for the view, O(N) for the pointer copy.
+
+
+//**Solution 3 : Binary Tree Image
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// On-disk layout, all little-endian, every section 8-byte aligned:
+//
+//   TreeImageHeader
+//   int32_t  values[count]     node values in level order (padded to 8 bytes)
+//   uint64_t bits[words]       bits 2i / 2i+1: node i has a left / right child
+//   uint32_t rank[words]       set bits in bits[0 .. w), for O(1) child lookup
+//
+// words = (2 * count + 63) / 64. checksum is FNV-1a over everything after
+// the header. A node's children are numbered by counting set bits: if bit
+// p is set, the child it describes is node 1 + (set bits before p).
+struct TreeImageHeader {
+    uint32_t magic;  // kTreeImageMagic
+    uint32_t version;
+    uint64_t count;
+    uint64_t checksum;
+};
+
+const uint32_t kTreeImageMagic = 0x31455254;  // "TRE1"
+
+inline uint64_t fnv1a(const void* data, size_t len, uint64_t h = 1469598103934665603ull) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Writes the tree rooted at root in one BFS pass. Values are streamed as
+// they are visited. What stays in memory is the structure bits (N / 4
+// bytes) until the end, plus the BFS frontier: two levels of node
+// pointers, which for a complete tree is up to about 3N/4 pointers (6N
+// bytes on 64-bit), so the frontier, not the bits, dominates on wide
+// trees. The header is written last, over a placeholder.
+// Returns false on any I/O error.
+inline bool writeTreeImage(node* root, FILE* f) {
+    TreeImageHeader hdr{kTreeImageMagic, 1, 0, 0};
+    if (fwrite(&hdr, sizeof hdr, 1, f) != 1) return false;
+
+    uint64_t h = 1469598103934665603ull;
+    vector<uint64_t> bits;
+    vector<node*> cur, next;
+    if (root) cur.push_back(root);
+    uint64_t n = 0;
+    while (!cur.empty()) {
+        next.clear();
+        for (node* x : cur) {
+            int32_t v = x->data;
+            if (fwrite(&v, sizeof v, 1, f) != 1) return false;
+            h = fnv1a(&v, sizeof v, h);
+            if (bits.size() * 64 < 2 * n + 2) bits.push_back(0);
+            if (x->left) {
+                bits[(2 * n) >> 6] |= 1ull << ((2 * n) & 63);
+                next.push_back(x->left);
+            }
+            if (x->right) {
+                bits[(2 * n + 1) >> 6] |= 1ull << ((2 * n + 1) & 63);
+                next.push_back(x->right);
+            }
+            n++;
+        }
+        cur.swap(next);
+    }
+    if (n % 2) {
+        int32_t pad = 0;
+        if (fwrite(&pad, sizeof pad, 1, f) != 1) return false;
+        h = fnv1a(&pad, sizeof pad, h);
+    }
+
+    vector<uint32_t> rank(bits.size());
+    uint32_t seen = 0;
+    for (size_t w = 0; w < bits.size(); w++) {
+        rank[w] = seen;
+        seen += __builtin_popcountll(bits[w]);
+    }
+    if (!bits.empty()) {
+        if (fwrite(bits.data(), sizeof(uint64_t), bits.size(), f) != bits.size()) return false;
+        if (fwrite(rank.data(), sizeof(uint32_t), rank.size(), f) != rank.size()) return false;
+        h = fnv1a(bits.data(), bits.size() * sizeof(uint64_t), h);
+        h = fnv1a(rank.data(), rank.size() * sizeof(uint32_t), h);
+    }
+
+    hdr.count = n;
+    hdr.checksum = h;
+    if (fseek(f, 0, SEEK_SET) != 0) return false;
+    return fwrite(&hdr, sizeof hdr, 1, f) == 1 && fflush(f) == 0;
+}
+
+// Read-only view of an image in memory; nothing is copied, so with a
+// mapped file each page is only read when a query touches it. Nodes are
+// level-order indices, -1 for "no child".
+class TreeImage {
+public:
+    // Checks the header and sizes; returns false if buf is not an image.
+    bool open(const void* buf, size_t len) {
+        if (len < sizeof(TreeImageHeader)) return false;
+        hdr = static_cast<const TreeImageHeader*>(buf);
+        if (hdr->magic != kTreeImageMagic || hdr->version != 1) return false;
+        uint64_t n = hdr->count;
+        // Every node takes at least 4 bytes, so a larger count is corrupt;
+        // checking this first also keeps the size arithmetic from wrapping.
+        if (n > (len - sizeof(TreeImageHeader)) / sizeof(int32_t)) return false;
+        words = (2 * n + 63) / 64;
+        uint64_t valueBytes = (n + (n & 1)) * sizeof(int32_t);
+        if (len != sizeof(TreeImageHeader) + valueBytes + words * 12) return false;
+        const char* p = static_cast<const char*>(buf) + sizeof(TreeImageHeader);
+        vals = reinterpret_cast<const int32_t*>(p);
+        bits = reinterpret_cast<const uint64_t*>(p + valueBytes);
+        rank = reinterpret_cast<const uint32_t*>(p + valueBytes + words * 8);
+        payloadLen = len - sizeof(TreeImageHeader);
+        return true;
+    }
+
+    // Reads the whole payload, so it faults in every page; optional.
+    bool verify() const { return fnv1a(hdr + 1, payloadLen) == hdr->checksum; }
+
+    int64_t size() const { return hdr->count; }
+    int value(int64_t i) const { return vals[i]; }
+    int64_t left(int64_t i) const { return child(2 * i); }
+    int64_t right(int64_t i) const { return child(2 * i + 1); }
+
+private:
+    const TreeImageHeader* hdr = nullptr;
+    const int32_t* vals = nullptr;
+    const uint64_t* bits = nullptr;
+    const uint32_t* rank = nullptr;
+    uint64_t words = 0;
+    size_t payloadLen = 0;
+
+    int64_t child(uint64_t p) const {
+        uint64_t w = bits[p >> 6];
+        uint64_t bit = 1ull << (p & 63);
+        if (!(w & bit)) return -1;
+        return 1 + rank[p >> 6] + __builtin_popcountll(w & (bit - 1));
+    }
+};
+
+// A TreeImage over a read-only mmap of a file. Opening costs one mmap
+// call regardless of tree size; pages fault in as they are used.
+class MappedTreeFile {
+public:
+    MappedTreeFile() = default;
+    MappedTreeFile(const MappedTreeFile&) = delete;
+    MappedTreeFile& operator=(const MappedTreeFile&) = delete;
+    ~MappedTreeFile() { close(); }
+
+    bool open(const char* path) {
+        close();
+        int fd = ::open(path, O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+        void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) return false;
+        base = p;
+        len = st.st_size;
+        if (!img.open(base, len)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        if (base) munmap(base, len);
+        base = nullptr;
+        len = 0;
+    }
+
+    const TreeImage& image() const { return img; }
+
+private:
+    void* base = nullptr;
+    size_t len = 0;
+    TreeImage img;
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) to write; O(1) to open a mapped image and per child lookup.
+
+// Space Complexity: O(N) while writing (N/4 bytes of structure bits plus the widest two levels of
+// node pointers), O(1) for the view.
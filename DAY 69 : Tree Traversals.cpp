@@ -1,3 +1,14 @@
+/**
+ * Definition of a binary tree node (provided by the judge).
+ * class TreeNode {
+ * public:
+ *     int data;
+ *     TreeNode *left, *right;
+ *     TreeNode() : data(0), left(nullptr), right(nullptr) {}
+ *     TreeNode(int x) : data(x), left(nullptr), right(nullptr) {}
+ *     TreeNode(int x, TreeNode *left, TreeNode *right) : data(x), left(left), right(right) {}
+ * };
+ */
 vector<vector<int>> getTreeTraversal(TreeNode *root) {
     vector<vector<int>> result(3);  // 2D vector to store the traversals: inorder, preorder, postorder
 
@@ -32,3 +43,205 @@ vector<vector<int>> getTreeTraversal(TreeNode *root) {
 
     return result;
 }
+
+
+//**Solution 2 : One Iterative Pass and Morris Traversal
+
+// Visits every node with threaded (Morris) links instead of a stack. Each
+// left subtree's rightmost node is pointed back at its ancestor on the way
+// down and reset on the way up, so the tree is unchanged when this returns.
+// emit(node) is called in inorder, or in preorder when preorder is true.
+template <typename Emit>
+void morrisTraversal(TreeNode *root, bool preorder, Emit emit) {
+    TreeNode* cur = root;
+    while (cur) {
+        if (!cur->left) {
+            emit(cur);
+            cur = cur->right;
+            continue;
+        }
+        TreeNode* pred = cur->left;
+        while (pred->right && pred->right != cur) pred = pred->right;
+        if (!pred->right) {
+            if (preorder) emit(cur);
+            pred->right = cur;
+            cur = cur->left;
+        } else {
+            pred->right = nullptr;
+            if (!preorder) emit(cur);
+            cur = cur->right;
+        }
+    }
+}
+
+vector<int> morrisInorder(TreeNode *root) {
+    vector<int> out;
+    morrisTraversal(root, false, [&](TreeNode* n) { out.push_back(n->data); });
+    return out;
+}
+
+vector<int> morrisPreorder(TreeNode *root) {
+    vector<int> out;
+    morrisTraversal(root, true, [&](TreeNode* n) { out.push_back(n->data); });
+    return out;
+}
+
+// All three orders in one walk. Each stack entry is a node and how many of
+// its visits have happened: state 0 emits preorder and descends left,
+// state 1 emits inorder and descends right, state 2 emits postorder and
+// pops. The node count from a Morris pass sizes every vector and the
+// stack exactly, so nothing reallocates.
+vector<vector<int>> getTreeTraversal(TreeNode *root) {
+    int n = 0;
+    morrisTraversal(root, false, [&](TreeNode*) { n++; });
+
+    vector<vector<int>> result(3);  // inorder, preorder, postorder
+    for (auto& order : result) order.reserve(n);
+
+    vector<pair<TreeNode*, int>> st;
+    st.reserve(n);
+    if (root) st.push_back({root, 0});
+    while (!st.empty()) {
+        auto& [node, state] = st.back();
+        if (state == 0) {
+            result[1].push_back(node->data);
+            state = 1;
+            if (node->left) st.push_back({node->left, 0});
+        } else if (state == 1) {
+            result[0].push_back(node->data);
+            state = 2;
+            if (node->right) st.push_back({node->right, 0});
+        } else {
+            result[2].push_back(node->data);
+            st.pop_back();
+        }
+    }
+    return result;
+}
+
+// Complexity Analysis
+// Time Complexity: O(N) for the fused pass and for each Morris traversal.
+
+// Space Complexity: O(H) stack for the fused pass (reserved as O(N)), O(1) for Morris.
+
+
+//**Solution 3 : Flat Tree with 32-bit Links
+
+// A copy of a TreeNode tree in three parallel arrays laid out in preorder:
+// node 0 is the root, a left child is always the next index, and every
+// child index is larger than its parent's. Links are 32-bit indices
+// (kNone for no child), so a node costs 12 bytes instead of 24, and
+// traversals walk the arrays mostly front to back.
+class FlatTree {
+public:
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    explicit FlatTree(TreeNode *root) {
+        struct Pending {
+            TreeNode* node;
+            uint32_t parent;
+            bool isRight;
+        };
+        vector<Pending> st;
+        if (root) st.push_back({root, kNone, false});
+        while (!st.empty()) {
+            Pending p = st.back();
+            st.pop_back();
+            uint32_t id = value.size();
+            if (p.parent != kNone) (p.isRight ? right : left)[p.parent] = id;
+            value.push_back(p.node->data);
+            left.push_back(kNone);
+            right.push_back(kNone);
+            // Right is pushed first so the whole left subtree is numbered
+            // before it.
+            if (p.node->right) st.push_back({p.node->right, id, true});
+            if (p.node->left) st.push_back({p.node->left, id, false});
+        }
+    }
+
+    int size() const { return value.size(); }
+
+    // The storage order is preorder.
+    vector<int> preorder() const { return value; }
+
+    vector<int> inorder() const {
+        vector<int> out;
+        out.reserve(size());
+        vector<uint32_t> st;
+        uint32_t cur = size() ? 0 : kNone;
+        while (cur != kNone || !st.empty()) {
+            for (; cur != kNone; cur = left[cur]) st.push_back(cur);
+            cur = st.back();
+            st.pop_back();
+            out.push_back(value[cur]);
+            cur = right[cur];
+        }
+        return out;
+    }
+
+    // Reverse of the root, right, left order.
+    vector<int> postorder() const {
+        vector<int> out;
+        out.reserve(size());
+        vector<uint32_t> st;
+        if (size()) st.push_back(0);
+        while (!st.empty()) {
+            uint32_t i = st.back();
+            st.pop_back();
+            out.push_back(value[i]);
+            if (left[i] != kNone) st.push_back(left[i]);
+            if (right[i] != kNone) st.push_back(right[i]);
+        }
+        reverse(out.begin(), out.end());
+        return out;
+    }
+
+    vector<vector<int>> levelOrder() const {
+        vector<vector<int>> ans;
+        vector<uint32_t> cur, next;
+        if (size()) cur.push_back(0);
+        while (!cur.empty()) {
+            ans.emplace_back();
+            ans.back().reserve(cur.size());
+            next.clear();
+            for (uint32_t i : cur) {
+                ans.back().push_back(value[i]);
+                if (left[i] != kNone) next.push_back(left[i]);
+                if (right[i] != kNone) next.push_back(right[i]);
+            }
+            cur.swap(next);
+        }
+        return ans;
+    }
+
+    // Children always come after their parent, so one backward scan sees
+    // every subtree before its root: heights need no recursion or stack.
+    int maxDepth() const { return heights(nullptr); }
+
+    bool isBalanced() const {
+        bool balanced = true;
+        heights(&balanced);
+        return balanced;
+    }
+
+private:
+    vector<int> value;
+    vector<uint32_t> left, right;
+
+    int heights(bool* balanced) const {
+        int n = size();
+        vector<int> h(n);
+        for (int i = n - 1; i >= 0; i--) {
+            int hl = left[i] == kNone ? 0 : h[left[i]];
+            int hr = right[i] == kNone ? 0 : h[right[i]];
+            if (balanced && abs(hl - hr) > 1) *balanced = false;
+            h[i] = max(hl, hr) + 1;
+        }
+        return n ? h[0] : 0;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) to build and for every traversal or query.
+
+// Space Complexity: O(N) for the 12-byte-per-node arrays, O(H) or O(W) scratch per traversal.
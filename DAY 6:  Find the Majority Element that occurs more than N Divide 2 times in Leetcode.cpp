@@ -26,3 +26,108 @@ public:
 // Note: If the question states that the array must contain a majority element, in that case, we do not need the second check. Then the time complexity will boil down to O(N).
 
 // Space Complexity: O(1) as we are not using any extra space.
+
+
+//**Solution 2 : Mergeable Vote States
+
+// (candidate, count) state of the Boyer-Moore vote.
+// merge() is not associative: grouping can change the resulting state,
+// e.g. (1,2), (2,1), (3,1) gives (1,0) left to right but (1,2) right to
+// left. What holds is that a true majority element survives any merge
+// order, so every chunk of the array can be voted on independently (one
+// chunk per thread or per shard), the partial states combined in any tree
+// shape, and the candidate then verified by a count.
+struct Vote {
+    int el = 0;
+    int cnt = 0;
+
+    void add(int x) {
+        if (cnt == 0) {
+            el = x;
+            cnt = 1;
+        }
+        else if (el == x) cnt++;
+        else cnt--;
+    }
+
+    static Vote merge(Vote a, Vote b) {
+        if (a.el == b.el) return {a.el, a.cnt + b.cnt};
+        if (a.cnt >= b.cnt) return {a.el, a.cnt - b.cnt};
+        return {b.el, b.cnt - a.cnt};
+    }
+};
+
+class Solution {
+public:
+    int majorityElement(vector<int>& nums) {
+        return majorityElement(span<const int>(nums));
+    }
+
+    // Read-only over any contiguous range, e.g. a memory-mapped column.
+    int majorityElement(span<const int> nums) {
+        int n = nums.size();
+        const int chunk = 1 << 16;
+
+        // Pass 1: vote per chunk, then merge the partial states.
+        Vote total;
+        for (int lo = 0; lo < n; lo += chunk) {
+            Vote part;
+            for (int i = lo; i < min(n, lo + chunk); i++) part.add(nums[i]);
+            total = Vote::merge(total, part);
+        }
+
+        // Pass 2: the verification count is a plain sum, so it splits the
+        // same way.
+        int cnt1 = 0;
+        for (int lo = 0; lo < n; lo += chunk) {
+            int part = 0;
+            for (int i = lo; i < min(n, lo + chunk); i++) part += nums[i] == total.el;
+            cnt1 += part;
+        }
+
+        if (cnt1 > (n / 2)) return total.el;
+        return -1;
+    }
+
+    // Misra-Gries: every element that occurs more than n/k times.
+    // At most k-1 elements can do that, so k-1 counters are enough. The
+    // first pass leaves a superset of the answer, the second pass verifies.
+    vector<int> majorityElements(vector<int>& nums, int k) {
+        return majorityElements(span<const int>(nums), k);
+    }
+
+    vector<int> majorityElements(span<const int> nums, int k) {
+        if (k <= 1) return {};  // nothing occurs more than n times
+        int n = nums.size();
+        vector<int> el(k - 1), cnt(k - 1, 0);
+
+        for (int x : nums) {
+            int slot = -1, empty = -1;
+            for (int j = 0; j < k - 1; j++) {
+                if (cnt[j] > 0 && el[j] == x) slot = j;
+                else if (cnt[j] == 0 && empty == -1) empty = j;
+            }
+            if (slot != -1) cnt[slot]++;
+            else if (empty != -1) {
+                el[empty] = x;
+                cnt[empty] = 1;
+            }
+            else {
+                for (int j = 0; j < k - 1; j++) cnt[j]--;
+            }
+        }
+
+        vector<int> ans;
+        for (int j = 0; j < k - 1; j++) {
+            if (cnt[j] == 0) continue;
+            int occ = 0;
+            for (int x : nums) occ += x == el[j];
+            if (occ > n / k) ans.push_back(el[j]);
+        }
+        return ans;
+    }
+};
+
+// Time Complexity: O(N) + O(N) for majorityElement, O(N*K) for majorityElements.
+
+// Space Complexity: O(1) for majorityElement, O(K) for majorityElements.
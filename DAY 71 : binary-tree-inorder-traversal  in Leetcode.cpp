@@ -1,3 +1,14 @@
+/**
+ * Definition for a binary tree node.
+ * struct TreeNode {
+ *     int val;
+ *     TreeNode *left;
+ *     TreeNode *right;
+ *     TreeNode() : val(0), left(nullptr), right(nullptr) {}
+ *     TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+ *     TreeNode(int x, TreeNode *left, TreeNode *right) : val(x), left(left), right(right) {}
+ * };
+ */
 class Solution {
 public:
     vector<int> inorderTraversal(TreeNode* root) {
@@ -17,3 +28,158 @@ private:
         inorderHelper(node->right, result); // Traverse right subtree
     }
 };
+
+
+//**Solution 2 : Iterator with a Small-Buffer Stack
+
+// LIFO stack whose first N entries live inside the object; deeper entries
+// spill to a vector. Traversals of trees up to depth N never allocate.
+template <typename T, int N = 64>
+class SmallStack {
+public:
+    bool empty() const { return count == 0; }
+
+    void push(T x) {
+        if (count < N) inl[count] = x;
+        else spill.push_back(x);
+        count++;
+    }
+
+    T top() const { return count <= N ? inl[count - 1] : spill.back(); }
+
+    void pop() {
+        if (count > N) spill.pop_back();
+        count--;
+    }
+
+private:
+    T inl[N];
+    vector<T> spill;
+    int count = 0;
+};
+
+// Forward iterator over values in inorder. The stack holds the path of
+// nodes whose left subtree is being walked; its top is the current node.
+class InorderIterator {
+public:
+    using iterator_category = forward_iterator_tag;
+    using value_type = int;
+    using difference_type = ptrdiff_t;
+    using pointer = const int*;
+    using reference = const int&;
+
+    explicit InorderIterator(TreeNode* root = nullptr) { pushLeft(root); }
+
+    const int& operator*() const { return path.top()->val; }
+    TreeNode* node() const { return path.empty() ? nullptr : path.top(); }
+
+    InorderIterator& operator++() {
+        TreeNode* done = path.top();
+        path.pop();
+        pushLeft(done->right);
+        return *this;
+    }
+
+    InorderIterator operator++(int) {
+        InorderIterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    bool operator==(const InorderIterator& o) const { return node() == o.node(); }
+    bool operator!=(const InorderIterator& o) const { return node() != o.node(); }
+
+private:
+    SmallStack<TreeNode*> path;
+
+    void pushLeft(TreeNode* n) {
+        for (; n; n = n->left) path.push(n);
+    }
+};
+
+// for (int v : InorderRange{root}) ...
+struct InorderRange {
+    TreeNode* root;
+    InorderIterator begin() const { return InorderIterator(root); }
+    InorderIterator end() const { return InorderIterator(); }
+};
+
+// Same traversal as a C++20 coroutine, for callers who prefer to write
+// the walk as a plain loop. IntGenerator is a minimal single-pass stand-in
+// for C++23 std::generator<int>. The coroutine frame, which holds the
+// SmallStack, is the one allocation per traversal; destroying the generator
+// early (break out of the loop) frees it.
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+class IntGenerator {
+public:
+    struct promise_type;
+    using handle = coroutine_handle<promise_type>;
+
+    struct promise_type {
+        int value = 0;
+        IntGenerator get_return_object() { return IntGenerator(handle::from_promise(*this)); }
+        suspend_always initial_suspend() noexcept { return {}; }
+        suspend_always final_suspend() noexcept { return {}; }
+        suspend_always yield_value(int v) noexcept {
+            value = v;
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() { throw; }
+    };
+
+    struct iterator {
+        handle h;
+        int operator*() const { return h.promise().value; }
+        iterator& operator++() {
+            h.resume();
+            return *this;
+        }
+        bool operator==(default_sentinel_t) const { return h.done(); }
+    };
+
+    explicit IntGenerator(handle h) : h(h) {}
+    IntGenerator(IntGenerator&& o) noexcept : h(exchange(o.h, {})) {}
+    IntGenerator(const IntGenerator&) = delete;
+    IntGenerator& operator=(const IntGenerator&) = delete;
+    ~IntGenerator() {
+        if (h) h.destroy();
+    }
+
+    // Single pass: begin() may be called once.
+    iterator begin() {
+        h.resume();
+        return {h};
+    }
+    default_sentinel_t end() const { return {}; }
+
+private:
+    handle h;
+};
+
+// for (int v : inorderValues(root)) ...
+inline IntGenerator inorderValues(TreeNode* root) {
+    SmallStack<TreeNode*> path;
+    for (TreeNode* n = root; n; n = n->left) path.push(n);
+    while (!path.empty()) {
+        TreeNode* done = path.top();
+        path.pop();
+        co_yield done->val;
+        for (TreeNode* n = done->right; n; n = n->left) path.push(n);
+    }
+}
+#endif
+
+class Solution {
+public:
+    vector<int> inorderTraversal(TreeNode* root) {
+        vector<int> result;
+        for (int v : InorderRange{root}) result.push_back(v);
+        return result;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), O(1) amortized per increment.
+
+// Space Complexity: O(H) for the stack, inline for H <= 64; the generator adds one coroutine frame.
@@ -27,3 +27,176 @@ public:
         return res;
     }
 };
+
+
+//**Solution 2 : Iterator with a Small-Buffer Stack
+
+// LIFO stack whose first N entries live inside the object; deeper entries
+// spill to a vector. Traversals of trees up to depth N never allocate.
+template <typename T, int N = 64>
+class SmallStack {
+public:
+    bool empty() const { return count == 0; }
+
+    void push(T x) {
+        if (count < N) inl[count] = x;
+        else spill.push_back(x);
+        count++;
+    }
+
+    T top() const { return count <= N ? inl[count - 1] : spill.back(); }
+
+    void pop() {
+        if (count > N) spill.pop_back();
+        count--;
+    }
+
+private:
+    T inl[N];
+    vector<T> spill;
+    int count = 0;
+};
+
+// Forward iterator over values in postorder. The stack holds the path from
+// the root to the current node, which is always on top. Descending to the
+// first node of a subtree prefers left, then right, until a leaf.
+class PostorderIterator {
+public:
+    using iterator_category = forward_iterator_tag;
+    using value_type = int;
+    using difference_type = ptrdiff_t;
+    using pointer = const int*;
+    using reference = const int&;
+
+    explicit PostorderIterator(TreeNode* root = nullptr) { descend(root); }
+
+    const int& operator*() const { return path.top()->val; }
+    TreeNode* node() const { return path.empty() ? nullptr : path.top(); }
+
+    // After a node, its parent comes next unless the node was a left child
+    // with a right sibling, in which case that sibling's subtree comes first.
+    PostorderIterator& operator++() {
+        TreeNode* done = path.top();
+        path.pop();
+        if (!path.empty()) {
+            TreeNode* parent = path.top();
+            if (parent->left == done && parent->right) descend(parent->right);
+        }
+        return *this;
+    }
+
+    PostorderIterator operator++(int) {
+        PostorderIterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    bool operator==(const PostorderIterator& o) const { return node() == o.node(); }
+    bool operator!=(const PostorderIterator& o) const { return node() != o.node(); }
+
+private:
+    SmallStack<TreeNode*> path;
+
+    void descend(TreeNode* n) {
+        while (n) {
+            path.push(n);
+            n = n->left ? n->left : n->right;
+        }
+    }
+};
+
+// for (int v : PostorderRange{root}) ...
+struct PostorderRange {
+    TreeNode* root;
+    PostorderIterator begin() const { return PostorderIterator(root); }
+    PostorderIterator end() const { return PostorderIterator(); }
+};
+
+// Same traversal as a C++20 coroutine, for callers who prefer to write
+// the walk as a plain loop. IntGenerator is a minimal single-pass stand-in
+// for C++23 std::generator<int>. The coroutine frame, which holds the
+// SmallStack, is the one allocation per traversal; destroying the generator
+// early (break out of the loop) frees it.
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+class IntGenerator {
+public:
+    struct promise_type;
+    using handle = coroutine_handle<promise_type>;
+
+    struct promise_type {
+        int value = 0;
+        IntGenerator get_return_object() { return IntGenerator(handle::from_promise(*this)); }
+        suspend_always initial_suspend() noexcept { return {}; }
+        suspend_always final_suspend() noexcept { return {}; }
+        suspend_always yield_value(int v) noexcept {
+            value = v;
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() { throw; }
+    };
+
+    struct iterator {
+        handle h;
+        int operator*() const { return h.promise().value; }
+        iterator& operator++() {
+            h.resume();
+            return *this;
+        }
+        bool operator==(default_sentinel_t) const { return h.done(); }
+    };
+
+    explicit IntGenerator(handle h) : h(h) {}
+    IntGenerator(IntGenerator&& o) noexcept : h(exchange(o.h, {})) {}
+    IntGenerator(const IntGenerator&) = delete;
+    IntGenerator& operator=(const IntGenerator&) = delete;
+    ~IntGenerator() {
+        if (h) h.destroy();
+    }
+
+    // Single pass: begin() may be called once.
+    iterator begin() {
+        h.resume();
+        return {h};
+    }
+    default_sentinel_t end() const { return {}; }
+
+private:
+    handle h;
+};
+
+// for (int v : postorderValues(root)) ...
+inline IntGenerator postorderValues(TreeNode* root) {
+    SmallStack<TreeNode*> path;
+    auto descend = [&path](TreeNode* n) {
+        while (n) {
+            path.push(n);
+            n = n->left ? n->left : n->right;
+        }
+    };
+    descend(root);
+    while (!path.empty()) {
+        TreeNode* done = path.top();
+        co_yield done->val;
+        path.pop();
+        if (!path.empty()) {
+            TreeNode* parent = path.top();
+            if (parent->left == done && parent->right) descend(parent->right);
+        }
+    }
+}
+#endif
+
+class Solution {
+public:
+    vector<int> postorderTraversal(TreeNode* root) {
+        vector<int> res;
+        for (int v : PostorderRange{root}) res.push_back(v);
+        return res;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), O(1) amortized per increment.
+
+// Space Complexity: O(H) for the stack, inline for H <= 64; the generator adds one coroutine frame.
@@ -1,4 +1,14 @@
-
+/**
+ * Definition for a binary tree node.
+ * struct TreeNode {
+ *     int val;
+ *     TreeNode *left;
+ *     TreeNode *right;
+ *     TreeNode() : val(0), left(nullptr), right(nullptr) {}
+ *     TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+ *     TreeNode(int x, TreeNode *left, TreeNode *right) : val(x), left(left), right(right) {}
+ * };
+ */
 class Solution {
 public:
 vector<vector<int>> levelOrder(TreeNode* root) {
@@ -29,3 +39,53 @@ vector<vector<int>> levelOrder(TreeNode* root) {
         return ans;
 }
 };
+
+
+//**Solution 2 : Swapped Frontiers and Flat Output
+
+// All levels in one array: level d is values[offsets[d] .. offsets[d + 1]).
+struct LevelOrder {
+    vector<int> values;
+    vector<int> offsets;
+};
+
+class Solution {
+public:
+    vector<vector<int>> levelOrder(TreeNode* root) {
+        LevelOrder flat = levelOrderFlat(root);
+        int levels = (int)flat.offsets.size() - 1;
+        vector<vector<int>> ans(max(levels, 0));
+        for (int d = 0; d < levels; d++) {
+            ans[d].assign(flat.values.begin() + flat.offsets[d],
+                          flat.values.begin() + flat.offsets[d + 1]);
+        }
+        return ans;
+    }
+
+    // BFS with two contiguous frontiers that are cleared and swapped per
+    // level; once they reach the widest level's size they stop allocating.
+    // Values go straight into one flat array.
+    LevelOrder levelOrderFlat(TreeNode* root) {
+        LevelOrder out;
+        out.offsets.push_back(0);
+        if (root == NULL) return out;
+
+        vector<TreeNode*> cur{root}, next;
+        while (!cur.empty()) {
+            next.clear();
+            for (TreeNode* node : cur) {
+                out.values.push_back(node->val);
+                if (node->left != NULL) next.push_back(node->left);
+                if (node->right != NULL) next.push_back(node->right);
+            }
+            out.offsets.push_back(out.values.size());
+            cur.swap(next);
+        }
+        return out;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N)
+
+// Space Complexity: O(W) for the frontiers, W = widest level, plus O(N) output.
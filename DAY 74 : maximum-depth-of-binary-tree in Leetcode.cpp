@@ -21,3 +21,377 @@ public:
         return totalDepth;
     }
 };
+
+
+//**Solution 2 : Work-Stealing Fork-Join Reduction
+
+// Fixed set of threads, each with its own deque of tasks. A thread works
+// on the newest task in its own deque and, when that is empty, steals the
+// oldest task from another deque; the oldest is usually the biggest.
+// The thread that calls run() takes part as worker 0 for the duration of
+// the call, so a pool of one thread is plain sequential code. Background
+// threads are started on the first run() and sleep when there is no work.
+// One run() at a time per pool.
+class TaskPool {
+public:
+    struct Task {
+        virtual void run() = 0;
+        virtual ~Task() = default;
+        atomic<bool> done{false};
+    };
+
+    explicit TaskPool(int threads = max(1u, thread::hardware_concurrency())) : size(max(threads, 1)) {}
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    ~TaskPool() {
+        {
+            lock_guard<mutex> lk(sleepLock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (thread& w : workers) w.join();
+    }
+
+    template <typename F>
+    auto run(F f) {
+        lock_guard<mutex> lk(runLock);
+        start();
+        struct Restore {
+            Slot saved;
+            ~Restore() { self = saved; }
+        } restore{self};
+        self = {this, 0};
+        return f();
+    }
+
+    // True while some worker has nothing to do, i.e. splitting off work pays.
+    bool hungry() const { return idle.load(memory_order_relaxed) > 0; }
+
+    // Queues t on the calling worker's deque. Only valid inside run().
+    void spawn(Task* t) {
+        Queue& q = *queues[self.index];
+        {
+            lock_guard<mutex> lk(q.lock);
+            q.tasks.push_back(t);
+        }
+        queued++;
+        if (idle > 0) {
+            lock_guard<mutex> lk(sleepLock);
+            wake.notify_one();
+        }
+    }
+
+    // Runs other tasks, including t itself if nobody stole it, until t is done.
+    void wait(Task* t) {
+        while (!t->done.load(memory_order_acquire)) {
+            if (Task* other = take(self.index)) execute(other);
+            else this_thread::yield();
+        }
+    }
+
+private:
+    struct alignas(64) Queue {
+        mutex lock;
+        deque<Task*> tasks;
+    };
+
+    struct Slot {
+        TaskPool* pool;
+        int index;
+    };
+
+    static inline thread_local Slot self{nullptr, 0};
+
+    int size;
+    vector<unique_ptr<Queue>> queues;
+    vector<thread> workers;
+    atomic<int> idle{0};
+    atomic<int> queued{0};
+    bool stopping = false;  // guarded by sleepLock
+    mutex sleepLock;
+    mutex runLock;
+    condition_variable wake;
+
+    void start() {
+        if (!queues.empty()) return;
+        for (int i = 0; i < size; i++) queues.push_back(make_unique<Queue>());
+        for (int i = 1; i < size; i++) workers.emplace_back([this, i] { work(i); });
+    }
+
+    Task* take(int index) {
+        if (queued == 0) return nullptr;
+        for (int k = 0; k < size; k++) {
+            Queue& q = *queues[(index + k) % size];
+            lock_guard<mutex> lk(q.lock);
+            if (q.tasks.empty()) continue;
+            Task* t;
+            if (k == 0) {
+                t = q.tasks.back();
+                q.tasks.pop_back();
+            }
+            else {
+                t = q.tasks.front();
+                q.tasks.pop_front();
+            }
+            queued--;
+            return t;
+        }
+        return nullptr;
+    }
+
+    // The owner may free t as soon as done is set, so nothing touches t after.
+    static void execute(Task* t) {
+        t->run();
+        t->done.store(true, memory_order_release);
+    }
+
+    void work(int index) {
+        self = {this, index};
+        while (true) {
+            if (Task* t = take(index)) {
+                execute(t);
+                continue;
+            }
+            idle++;
+            bool stop;
+            {
+                unique_lock<mutex> lk(sleepLock);
+                wake.wait(lk, [&] { return stopping || queued > 0; });
+                stop = stopping;
+            }
+            idle--;
+            if (stop && queued == 0) return;
+        }
+    }
+};
+
+// Subtrees smaller than this are never split off: below it the cost of a
+// task outweighs the work it carries.
+inline constexpr int kTaskGrain = 1 << 14;
+
+// Whether the subtree at root has at least limit nodes. Stops counting at
+// limit, so the cost is O(min(size, limit)).
+inline bool atLeastNodes(TreeNode* root, int limit) {
+    vector<TreeNode*> st{root};
+    int seen = 0;
+    while (!st.empty()) {
+        TreeNode* n = st.back();
+        st.pop_back();
+        if (++seen >= limit) return true;
+        if (n->left) st.push_back(n->left);
+        if (n->right) st.push_back(n->right);
+    }
+    return false;
+}
+
+// Bottom-up reduction: the result for a node is combine(node, result of
+// left subtree, result of right subtree), and an empty subtree gives
+// empty. Each walk is iterative over a heap stack, so a degenerate tree of
+// any height is fine. Right subtrees are only split off as tasks when a
+// worker is idle and the subtree holds at least kTaskGrain nodes, so null
+// and small children never become tasks and the split follows subtree
+// size, not depth: a skewed tree is split along its spine wherever a big
+// enough branch hangs off it. Once a right subtree has been measured as
+// small, nothing inside it is measured again, which keeps the counting at
+// O(1) amortized per node.
+template <typename R, typename Combine>
+class TreeReducer {
+public:
+    TreeReducer(TaskPool& pool, R empty, Combine combine) : pool(pool), empty(empty), combine(combine) {}
+
+    R reduce(TreeNode* root) {
+        if (root == nullptr) return empty;
+        vector<Frame> st;
+        st.push_back({root, 0, empty, empty, nullptr, false});
+        size_t quiet = 0;  // if set, frames deeper than this are in a small subtree
+        R result = empty;
+        while (!st.empty()) {
+            if (quiet && st.size() <= quiet) quiet = 0;
+            Frame& f = st.back();
+            TreeNode* n = f.node;
+            if (f.stage == 0) {
+                f.stage = 1;
+                if (!quiet && n->right && pool.hungry()) {
+                    if (atLeastNodes(n->right, kTaskGrain)) {
+                        f.task = new SubtreeTask(this, n->right);
+                        pool.spawn(f.task);
+                    }
+                    else {
+                        f.rightSmall = true;
+                    }
+                }
+                if (n->left) st.push_back({n->left, 0, empty, empty, nullptr, false});
+            }
+            else if (f.stage == 1) {
+                f.stage = 2;
+                if (!f.task && n->right) {
+                    if (f.rightSmall && !quiet) quiet = st.size();
+                    st.push_back({n->right, 0, empty, empty, nullptr, false});
+                }
+            }
+            else {
+                if (f.task) {
+                    pool.wait(f.task);
+                    f.right = f.task->result;
+                    delete f.task;
+                }
+                R v = combine(n, f.left, f.right);
+                st.pop_back();
+                if (st.empty()) result = v;
+                else if (st.back().stage == 1) st.back().left = v;
+                else st.back().right = v;
+            }
+        }
+        return result;
+    }
+
+private:
+    struct SubtreeTask : TaskPool::Task {
+        TreeReducer* owner;
+        TreeNode* root;
+        R result;
+        SubtreeTask(TreeReducer* owner, TreeNode* root) : owner(owner), root(root), result(owner->empty) {}
+        void run() override { result = owner->reduce(root); }
+    };
+
+    // stage 0: left not started, 1: left done, 2: right done.
+    struct Frame {
+        TreeNode* node;
+        int stage;
+        R left;
+        R right;
+        SubtreeTask* task;  // right subtree running elsewhere, if any
+        bool rightSmall;
+    };
+
+    TaskPool& pool;
+    R empty;
+    Combine combine;
+};
+
+template <typename R, typename Combine>
+R reduceTree(TaskPool& pool, TreeNode* root, R empty, Combine combine) {
+    TreeReducer<R, Combine> reducer(pool, empty, combine);
+    return pool.run([&] { return reducer.reduce(root); });
+}
+
+// Preorder values, split the same way. Each walk appends to its own chunk
+// and records where a split-off subtree's values belong; the chunks are
+// stitched together in order at the end, so the result is exact.
+class PreorderCollector {
+public:
+    explicit PreorderCollector(TaskPool& pool) : pool(pool) {}
+
+    vector<int> collect(TreeNode* root) {
+        Chunk top;
+        if (root) walk(root, top);
+        return flatten(top);
+    }
+
+private:
+    struct SubtreeTask;
+
+    struct Chunk {
+        vector<int> values;
+        // (position in values, task whose values go there)
+        vector<pair<size_t, unique_ptr<SubtreeTask>>> splits;
+    };
+
+    struct SubtreeTask : TaskPool::Task {
+        PreorderCollector* owner;
+        TreeNode* root;
+        Chunk out;
+        SubtreeTask(PreorderCollector* owner, TreeNode* root) : owner(owner), root(root) {}
+        void run() override { owner->walk(root, out); }
+    };
+
+    TaskPool& pool;
+
+    void walk(TreeNode* root, Chunk& out) {
+        vector<TreeNode*> st{root};
+        bool quiet = false;
+        size_t quietLevel = 0;  // while quiet, entries above this are in a small subtree
+        while (!st.empty()) {
+            if (quiet && st.size() <= quietLevel) quiet = false;
+            TreeNode* n = st.back();
+            st.pop_back();
+            if (!quiet && n != root && (n->left || n->right) && pool.hungry()) {
+                if (atLeastNodes(n, kTaskGrain)) {
+                    auto t = make_unique<SubtreeTask>(this, n);
+                    pool.spawn(t.get());
+                    out.splits.push_back({out.values.size(), move(t)});
+                    continue;
+                }
+                quiet = true;
+                quietLevel = st.size();
+            }
+            out.values.push_back(n->val);
+            if (n->right) st.push_back(n->right);
+            if (n->left) st.push_back(n->left);
+        }
+        for (auto& s : out.splits) pool.wait(s.second.get());
+    }
+
+    static vector<int> flatten(const Chunk& top) {
+        struct Pos {
+            const Chunk* chunk;
+            size_t nextSplit;
+            size_t from;
+        };
+        vector<int> out;
+        vector<Pos> st{{&top, 0, 0}};
+        while (!st.empty()) {
+            Pos& p = st.back();
+            const vector<int>& v = p.chunk->values;
+            if (p.nextSplit < p.chunk->splits.size()) {
+                const auto& s = p.chunk->splits[p.nextSplit++];
+                out.insert(out.end(), v.begin() + p.from, v.begin() + s.first);
+                p.from = s.first;
+                st.push_back({&s.second->out, 0, 0});
+            }
+            else {
+                out.insert(out.end(), v.begin() + p.from, v.end());
+                st.pop_back();
+            }
+        }
+        return out;
+    }
+};
+
+inline vector<int> collectPreorder(TaskPool& pool, TreeNode* root) {
+    PreorderCollector collector(pool);
+    return pool.run([&] { return collector.collect(root); });
+}
+
+class Solution {
+public:
+    int maxDepth(TreeNode* root) {
+        return reduceTree(pool, root, 0, [](TreeNode*, int l, int r) { return max(l, r) + 1; });
+    }
+
+    long long sum(TreeNode* root) {
+        return reduceTree(pool, root, 0LL, [](TreeNode* n, long long l, long long r) { return l + r + n->val; });
+    }
+
+    // Height of each subtree, or -1 once any subtree below is unbalanced.
+    bool isBalanced(TreeNode* root) {
+        return reduceTree(pool, root, 0, [](TreeNode*, int l, int r) {
+            if (l < 0 || r < 0 || abs(l - r) > 1) return -1;
+            return max(l, r) + 1;
+        }) >= 0;
+    }
+
+    vector<int> preorder(TreeNode* root) {
+        return collectPreorder(pool, root);
+    }
+
+private:
+    TaskPool pool;
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) work, about O(N/P + H) wall time on P cores when the tree has enough big branches.
+
+// Space Complexity: O(H) heap stack per walk instead of call stack, plus O(N) chunks for preorder.
@@ -27,3 +27,126 @@ public:
         
     }
 };
+
+
+//**Solution 2 : Early Exit and Cached Heights
+
+class Solution {
+public:
+    // Height of root, or -1 as soon as any subtree is unbalanced; once a
+    // -1 appears no further subtree is visited.
+    int solve(TreeNode* root) {
+        if (root == NULL)
+            return 0;
+        int l = solve(root->left);
+        if (l < 0) return -1;
+        int r = solve(root->right);
+        if (r < 0 || abs(l - r) > 1) return -1;
+        return max(l, r) + 1;
+    }
+    bool isBalanced(TreeNode* root) {
+        return solve(root) >= 0;
+    }
+};
+
+// Binary search tree that keeps every subtree's height and the number of
+// unbalanced nodes up to date, so maxDepth (DAY 74) and isBalanced are O(1)
+// between mutations. insert and erase recompute heights only along the
+// path from the changed node to the root, and stop early once a node's
+// height and balance come out unchanged, since nothing above can change.
+// The tree is not self-balancing; it only reports its shape.
+class HeightTree {
+    struct Node {
+        int val;
+        int height = 1;
+        bool unbalanced = false;
+        Node* left = nullptr;
+        Node* right = nullptr;
+        Node* parent = nullptr;
+        explicit Node(int v, Node* p) : val(v), parent(p) {}
+    };
+
+    Node* root = nullptr;
+    int badCount = 0;
+    int count = 0;
+
+    static int h(Node* n) { return n ? n->height : 0; }
+
+    void fixUp(Node* n) {
+        for (; n; n = n->parent) {
+            int hl = h(n->left), hr = h(n->right);
+            int height = max(hl, hr) + 1;
+            bool bad = abs(hl - hr) > 1;
+            if (height == n->height && bad == n->unbalanced) break;
+            badCount += (int)bad - (int)n->unbalanced;
+            n->height = height;
+            n->unbalanced = bad;
+        }
+    }
+
+public:
+    HeightTree() = default;
+    HeightTree(const HeightTree&) = delete;
+    HeightTree& operator=(const HeightTree&) = delete;
+    ~HeightTree() {
+        vector<Node*> st;
+        if (root) st.push_back(root);
+        while (!st.empty()) {
+            Node* n = st.back();
+            st.pop_back();
+            if (n->left) st.push_back(n->left);
+            if (n->right) st.push_back(n->right);
+            delete n;
+        }
+    }
+
+    int size() const { return count; }
+    int maxDepth() const { return h(root); }
+    bool isBalanced() const { return badCount == 0; }
+
+    // Equal values go to the right subtree.
+    void insert(int x) {
+        Node* p = nullptr;
+        Node** link = &root;
+        while (*link) {
+            p = *link;
+            link = x < p->val ? &p->left : &p->right;
+        }
+        *link = new Node(x, p);
+        count++;
+        fixUp(p);
+    }
+
+    // Removes one node holding x; returns false if there is none.
+    bool erase(int x) {
+        Node* z = root;
+        while (z && z->val != x) z = x < z->val ? z->left : z->right;
+        if (!z) return false;
+
+        // A node with two children takes its successor's value, and the
+        // successor, which has no left child, is unlinked instead.
+        if (z->left && z->right) {
+            Node* y = z->right;
+            while (y->left) y = y->left;
+            z->val = y->val;
+            z = y;
+        }
+        Node* child = z->left ? z->left : z->right;
+        Node* p = z->parent;
+        if (child) child->parent = p;
+        if (!p) root = child;
+        else if (p->left == z) p->left = child;
+        else p->right = child;
+
+        badCount -= z->unbalanced;
+        delete z;
+        count--;
+        fixUp(p);
+        return true;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: isBalanced O(N) with early exit; HeightTree insert/erase O(depth), queries O(1).
+
+// Space Complexity: O(H) recursion; HeightTree O(N).
@@ -21,3 +21,104 @@ public:
 // Reason: We are using a single loop running N times.
 
 // Space Complexity: O(1) as we are not using any extra space.
+
+
+//**Solution 2 : Segment Summaries
+
+// Summary of a contiguous segment: its total, best prefix, best suffix and
+// best subarray, with the indices that achieve them. Two adjacent summaries
+// combine in O(1), so chunks can be summarised independently and reduced
+// as a tree, and a stream can be extended one element at a time.
+struct Segment {
+    long long total, pre, suf, best;
+    int preEnd, sufBegin, bestL, bestR;
+
+    static Segment leaf(int i, int x) {
+        return {x, x, x, x, i, i, i, i};
+    }
+
+    // a must lie immediately to the left of b.
+    static Segment combine(const Segment& a, const Segment& b) {
+        Segment s;
+        s.total = a.total + b.total;
+
+        s.pre = a.pre, s.preEnd = a.preEnd;
+        if (a.total + b.pre > s.pre) s.pre = a.total + b.pre, s.preEnd = b.preEnd;
+
+        s.suf = b.suf, s.sufBegin = b.sufBegin;
+        if (b.total + a.suf > s.suf) s.suf = b.total + a.suf, s.sufBegin = a.sufBegin;
+
+        s.best = a.best, s.bestL = a.bestL, s.bestR = a.bestR;
+        if (b.best > s.best) s.best = b.best, s.bestL = b.bestL, s.bestR = b.bestR;
+        if (a.suf + b.pre > s.best) s.best = a.suf + b.pre, s.bestL = a.sufBegin, s.bestR = b.preEnd;
+        return s;
+    }
+};
+
+class Solution {
+public:
+    int maxSubArray(vector<int>& nums) {
+        return maxSubArrayRange(nums).best;
+    }
+
+    // Best subarray with its [bestL, bestR] indices.
+    Segment maxSubArrayRange(vector<int>& nums) {
+        return maxSubArrayRange(span<const int>(nums));
+    }
+
+    // Read-only over any contiguous range, e.g. a memory-mapped column.
+    // An empty range has no subarray: best is LLONG_MIN and every index -1.
+    Segment maxSubArrayRange(span<const int> nums) {
+        int n = nums.size();
+        if (n == 0) return {0, LLONG_MIN, LLONG_MIN, LLONG_MIN, -1, -1, -1, -1};
+        const int chunk = 1 << 14;
+
+        // Each chunk only reads its own range, so this loop can be spread
+        // across threads without changing the result.
+        vector<Segment> parts;
+        for (int lo = 0; lo < n; lo += chunk) {
+            Segment s = Segment::leaf(lo, nums[lo]);
+            for (int i = lo + 1; i < min(n, lo + chunk); i++) {
+                s = Segment::combine(s, Segment::leaf(i, nums[i]));
+            }
+            parts.push_back(s);
+        }
+
+        // Tree reduction: combine neighbours pairwise until one is left.
+        while (parts.size() > 1) {
+            int m = 0;
+            for (int i = 0; i + 1 < parts.size(); i += 2) {
+                parts[m++] = Segment::combine(parts[i], parts[i + 1]);
+            }
+            if (parts.size() % 2) parts[m++] = parts.back();
+            parts.resize(m);
+        }
+        return parts[0];
+    }
+};
+
+// Running maximum subarray of a stream. append() folds the new element
+// into the summary of everything seen so far, so history is never rescanned.
+class MaxSubArrayStream {
+    Segment s;
+    int n = 0;
+
+public:
+    void append(int x) {
+        s = n == 0 ? Segment::leaf(0, x) : Segment::combine(s, Segment::leaf(n, x));
+        n++;
+    }
+
+    // Folds in a chunk of the stream, e.g. one window of a mapped file.
+    void append(span<const int> chunk) {
+        for (int x : chunk) append(x);
+    }
+
+    // Only valid once at least one element was appended.
+    const Segment& summary() const { return s; }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N), O(1) per element appended to the stream.
+
+// Space Complexity: O(N / chunk) for the chunk summaries, O(1) for the stream.
@@ -45,3 +45,133 @@ class Solution{
 
 // O(1) {If Space of union ArrayList is not considered}
 
+
+
+//**Solution 2 : Galloping Set Operations
+
+class Solution{
+    public:
+    vector<int> findUnion(int arr1[], int arr2[], int n, int m)
+    {
+        vector<int> Union;
+        Union.reserve(n + m);  // upper bound, no regrowth while merging
+        if (n > m) {
+            swap(arr1, arr2);
+            swap(n, m);
+        }
+        if (skewed(n, m)) {
+            // For each element of the short array, gallop to its position in
+            // the long one and copy the run in between.
+            int j = 0;
+            for (int i = 0; i < n; i++) {
+                int k = gallop(arr2, j, m, arr1[i]);
+                for (; j < k; j++) add(Union, arr2[j]);
+                add(Union, arr1[i]);
+            }
+            for (; j < m; j++) add(Union, arr2[j]);
+            return Union;
+        }
+        int i = 0, j = 0;
+        while (i < n && j < m) {
+            if (arr1[i] <= arr2[j]) add(Union, arr1[i++]);
+            else add(Union, arr2[j++]);
+        }
+        while (i < n) add(Union, arr1[i++]);
+        while (j < m) add(Union, arr2[j++]);
+        return Union;
+    }
+
+    // Distinct elements present in both arrays.
+    vector<int> findIntersection(int arr1[], int arr2[], int n, int m)
+    {
+        vector<int> out;
+        out.reserve(min(n, m));
+        if (n > m) {
+            swap(arr1, arr2);
+            swap(n, m);
+        }
+        int j = 0;
+        for (int i = 0; i < n && j < m; i++) {
+            if (i > 0 && arr1[i] == arr1[i - 1]) continue;
+            j = skewed(n, m) ? gallop(arr2, j, m, arr1[i]) : scan(arr2, j, m, arr1[i]);
+            if (j < m && arr2[j] == arr1[i]) out.push_back(arr1[i]);
+        }
+        return out;
+    }
+
+    // Distinct elements of arr1 that are not in arr2.
+    vector<int> findDifference(int arr1[], int arr2[], int n, int m)
+    {
+        vector<int> out;
+        out.reserve(n);
+        bool fast = m > n && skewed(n, m);
+        int j = 0;
+        for (int i = 0; i < n; i++) {
+            if (i > 0 && arr1[i] == arr1[i - 1]) continue;
+            j = fast ? gallop(arr2, j, m, arr1[i]) : scan(arr2, j, m, arr1[i]);
+            if (j == m || arr2[j] != arr1[i]) out.push_back(arr1[i]);
+        }
+        return out;
+    }
+
+    // Union of k sorted lists, merged pairwise so every element takes part
+    // in O(log k) merges.
+    vector<int> findUnion(vector<vector<int>>& lists)
+    {
+        if (lists.empty()) return {};
+        vector<vector<int>> level = lists;
+        while (level.size() > 1) {
+            vector<vector<int>> next;
+            for (int i = 0; i + 1 < level.size(); i += 2) {
+                next.push_back(findUnion(level[i].data(), level[i + 1].data(),
+                                         level[i].size(), level[i + 1].size()));
+            }
+            if (level.size() % 2) next.push_back(move(level.back()));
+            level = move(next);
+        }
+        // A single input list may still contain duplicates.
+        vector<int> out;
+        out.reserve(level[0].size());
+        for (int x : level[0]) add(out, x);
+        return out;
+    }
+
+    private:
+    // Galloping pays off once one side is much longer than the other.
+    static bool skewed(int n, int m) { return (long long)n * 8 < m; }
+
+    static void add(vector<int>& out, int x)
+    {
+        if (out.empty() || out.back() != x) out.push_back(x);
+    }
+
+    // First index k in [lo, n) with arr[k] >= x, by linear scan.
+    static int scan(int arr[], int lo, int n, int x)
+    {
+        while (lo < n && arr[lo] < x) lo++;
+        return lo;
+    }
+
+    // First index k in [lo, n) with arr[k] >= x. Probes lo+1, lo+2, lo+4, ...
+    // then binary searches the last step, so the cost is O(log d) where d
+    // is how far the answer is from lo.
+    static int gallop(int arr[], int lo, int n, int x)
+    {
+        if (lo >= n || arr[lo] >= x) return lo;
+        int step = 1, prev = lo;
+        while (lo + step < n && arr[lo + step] < x) {
+            prev = lo + step;
+            step <<= 1;
+        }
+        int hi = min(n, lo + step);
+        return lower_bound(arr + prev + 1, arr + hi, x) - arr;
+    }
+};
+
+
+
+// Complexity Analysis
+// Time Complexity: O(m+n) for the union. Intersection and difference cost
+// O(n*log(m/n)) when one array is much shorter than the other.
+
+// Space Complexity : O(m+n) for the output, O(1) otherwise.
@@ -21,3 +21,113 @@ public:
 
 // Space Complexity: O(1)
 
+
+
+//**Solution 2 : Streaming Ticks
+
+// Single transaction over every tick seen so far. Same recurrence as
+// maxProfit above, kept as state so ticks can arrive one at a time.
+class StockStream {
+    int minPrice = INT_MAX;
+    int maxPro = 0;
+
+public:
+    void add(int price) {
+        minPrice = min(minPrice, price);
+        maxPro = max(maxPro, price - minPrice);
+    }
+
+    void add(const int prices[], int n) {
+        for (int i = 0; i < n; i++) add(prices[i]);
+    }
+
+    void add(span<const int> prices) { add(prices.data(), prices.size()); }
+
+    int best() const { return maxPro; }
+};
+
+// At most k transactions. buy[j] is the best balance while holding the
+// j-th share, sell[j] the best balance after selling it. O(k) per tick.
+class StockStreamK {
+    vector<int> buy, sell;
+
+public:
+    StockStreamK(int k) : buy(k, INT_MIN), sell(k, 0) {}
+
+    void add(int price) {
+        for (int j = 0; j < buy.size(); j++) {
+            buy[j] = max(buy[j], (j == 0 ? 0 : sell[j - 1]) - price);
+            sell[j] = max(sell[j], buy[j] + price);
+        }
+    }
+
+    void add(const int prices[], int n) {
+        for (int i = 0; i < n; i++) add(prices[i]);
+    }
+
+    void add(span<const int> prices) { add(prices.data(), prices.size()); }
+
+    int best() const { return sell.empty() ? 0 : sell.back(); }
+};
+
+// Single transaction over the last W ticks only.
+// The window is a queue built from two stacks, each entry carrying the
+// (min, max, best profit) of a run of ticks. Those summaries combine in
+// O(1), so add() and best() are amortized O(1) and memory stays at O(W).
+class StockWindow {
+    struct Agg {
+        int lo, hi, best;
+    };
+
+    // older must hold the ticks right before newer.
+    static Agg combine(const Agg& older, const Agg& newer) {
+        return {min(older.lo, newer.lo), max(older.hi, newer.hi),
+                max(max(older.best, newer.best), newer.hi - older.lo)};
+    }
+
+    int W;
+    vector<Agg> front;   // front.back() summarises every tick in front
+    vector<int> back;    // newest ticks, in arrival order
+    Agg backAgg = {0, 0, 0};
+
+    void popOldest() {
+        if (front.empty()) {
+            for (int i = back.size() - 1; i >= 0; i--) {
+                Agg leaf = {back[i], back[i], 0};
+                front.push_back(front.empty() ? leaf : combine(leaf, front.back()));
+            }
+            back.clear();
+        }
+        front.pop_back();
+    }
+
+public:
+    StockWindow(int W) : W(W) {
+        front.reserve(W);
+        back.reserve(W);
+    }
+
+    void add(int price) {
+        Agg leaf = {price, price, 0};
+        backAgg = back.empty() ? leaf : combine(backAgg, leaf);
+        back.push_back(price);
+        if (front.size() + back.size() > W) popOldest();
+    }
+
+    void add(span<const int> prices) {
+        for (int x : prices) add(x);
+    }
+
+    int best() const {
+        if (back.empty()) return front.empty() ? 0 : front.back().best;
+        if (front.empty()) return backAgg.best;
+        return combine(front.back(), backAgg).best;
+    }
+};
+
+// Complexity Analysis
+
+// Time complexity: O(1) per tick, O(k) per tick with k transactions,
+// amortized O(1) per tick for the window
+
+// Space Complexity: O(1), O(k) and O(W) respectively
@@ -18,3 +18,62 @@ public:
         return result;
     }
 };
+
+
+//**Solution 2 : Stable Argsort and Gather
+
+class Solution {
+public:
+    vector<string> sortPeople(vector<string>& names, vector<int>& heights) {
+        vector<int> idx = argsortDescending(heights);
+        return gather(names, idx);
+    }
+
+    // Indices of keys ordered from largest to smallest; equal keys keep
+    // their input order, so people sharing a height are never dropped.
+    // heights is left untouched.
+    //
+    // LSD radix over the 32-bit keys, 8 bits per pass, sorting indices only.
+    // Keys are mapped with ~(x ^ sign bit) so that an ascending radix sort of
+    // the mapped value is a descending sort of x. Passes whose byte is the
+    // same for every key are skipped, which for heights (< 2^17) leaves at
+    // most three. Small inputs fall back to stable_sort.
+    static vector<int> argsortDescending(const vector<int>& keys) {
+        int n = keys.size();
+        vector<int> idx(n);
+        iota(idx.begin(), idx.end(), 0);
+        if (n < 64) {
+            stable_sort(idx.begin(), idx.end(), [&](int a, int b) { return keys[a] > keys[b]; });
+            return idx;
+        }
+
+        vector<unsigned> mapped(n);
+        for (int i = 0; i < n; i++) mapped[i] = ~((unsigned)keys[i] ^ 0x80000000u);
+
+        vector<int> tmp(n);
+        for (int shift = 0; shift < 32; shift += 8) {
+            int cnt[257] = {0};
+            for (int i : idx) cnt[(mapped[i] >> shift & 255) + 1]++;
+            if (*max_element(cnt + 1, cnt + 257) == n) continue;
+            for (int b = 0; b < 256; b++) cnt[b + 1] += cnt[b];
+            for (int i : idx) tmp[cnt[mapped[i] >> shift & 255]++] = i;
+            idx.swap(tmp);
+        }
+        return idx;
+    }
+
+    // Moves payload[idx[0]], payload[idx[1]], ... into the result. payload
+    // is consumed: its strings are left empty rather than copied.
+    template <typename T>
+    static vector<T> gather(vector<T>& payload, const vector<int>& idx) {
+        vector<T> out;
+        out.reserve(idx.size());
+        for (int i : idx) out.push_back(move(payload[i]));
+        return out;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(N) for the radix passes plus O(N) moves; O(N*log(N)) below 64 people.
+
+// Space Complexity: O(N) for the index, mapped key and scratch arrays.
@@ -1,4 +1,20 @@
+/**
+ * Definition provided by the judge.
+ * class MyStack {
+ * private:
+ *     int arr[1000];
+ *     int top;
+ * public:
+ *     MyStack() { top = -1; }
+ *     int pop();
+ *     void push(int);
+ * };
+ */
 void MyStack ::push(int x) {
+    // Drop the push when the fixed array is full instead of writing past it.
+    if (top + 1 == (int)(sizeof(arr) / sizeof(arr[0]))) {
+        return;
+    }
     top++;
     arr[top]=x;
     
@@ -13,3 +29,122 @@ int MyStack ::pop() {
     top--;
     return y;
 }
+
+
+//**Solution 2 : Growable Array Stack
+
+// Stack over one contiguous buffer. The first Inline elements live inside
+// the object, so shallow stacks never allocate; past that the buffer grows
+// by doubling and is never shrunk. Works for any movable T.
+template <typename T, int Inline = 64>
+class ArrayStack {
+public:
+    ArrayStack() = default;
+    ArrayStack(const ArrayStack&) = delete;
+    ArrayStack& operator=(const ArrayStack&) = delete;
+    ~ArrayStack() {
+        clear();
+        if (data != inlineData()) ::operator delete(data);
+    }
+
+    bool empty() const { return count == 0; }
+    int size() const { return count; }
+    T& top() { return data[count - 1]; }
+
+    void push(const T& x) { emplace(x); }
+    void push(T&& x) { emplace(move(x)); }
+
+    // args may refer to an element of this stack (push(top())), so when the
+    // buffer is full the new element is built in the new buffer before the
+    // old elements are moved out from under it.
+    template <typename... Args>
+    T& emplace(Args&&... args) {
+        T* p;
+        if (count == cap) {
+            T* fresh = allocate(cap * 2);
+            try {
+                p = new (fresh + count) T(forward<Args>(args)...);
+            }
+            catch (...) {
+                ::operator delete(fresh);
+                throw;
+            }
+            adopt(fresh, cap * 2);
+        }
+        else {
+            p = new (data + count) T(forward<Args>(args)...);
+        }
+        count++;
+        return *p;
+    }
+
+    // Removes the top element. The stack must not be empty.
+    void pop() {
+        data[--count].~T();
+    }
+
+    // Pushes src[0..n) so that src[n - 1] ends on top. Grows at most once;
+    // src may point into this stack, as with emplace.
+    void push_n(const T* src, int n) {
+        if (count + n > cap) {
+            int newCap = max(cap * 2, count + n);
+            T* fresh = allocate(newCap);
+            int built = 0;
+            try {
+                for (; built < n; built++) new (fresh + count + built) T(src[built]);
+            }
+            catch (...) {
+                while (built > 0) fresh[count + --built].~T();
+                ::operator delete(fresh);
+                throw;
+            }
+            adopt(fresh, newCap);
+        }
+        else {
+            for (int i = 0; i < n; i++) new (data + count + i) T(src[i]);
+        }
+        count += n;
+    }
+
+    // Pops up to n elements into out, top first, and returns how many.
+    int pop_n(T* out, int n) {
+        n = min(n, count);
+        for (int i = 0; i < n; i++) {
+            out[i] = move(data[count - 1]);
+            pop();
+        }
+        return n;
+    }
+
+    void clear() {
+        while (count > 0) pop();
+    }
+
+private:
+    alignas(T) unsigned char inlineBuf[Inline * sizeof(T)];
+    T* data = inlineData();
+    int count = 0;
+    int cap = Inline;
+
+    T* inlineData() { return reinterpret_cast<T*>(inlineBuf); }
+
+    static T* allocate(int n) {
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    // Moves the current elements into fresh, which becomes the buffer.
+    void adopt(T* fresh, int newCap) {
+        for (int i = 0; i < count; i++) {
+            new (fresh + i) T(move(data[i]));
+            data[i].~T();
+        }
+        if (data != inlineData()) ::operator delete(data);
+        data = fresh;
+        cap = newCap;
+    }
+};
+
+// Complexity Analysis
+// Time Complexity: O(1) amortized for push/emplace, O(1) for pop, O(n) for push_n/pop_n.
+
+// Space Complexity: O(N)